@@ -0,0 +1,50 @@
+// big_integer.h
+#ifndef BIG_INTEGER_H
+#define BIG_INTEGER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Arbitrary precision integer. Every operation returns a newly allocated value, in
+// the same way as the Polynomial arithmetic, to be released with free_big_integer.
+typedef struct
+{
+    int sign;        // -1, 0 or 1
+    int size;        // limbs in use; 0 for zero
+    uint32_t *limbs; // magnitude, least significant limb first
+} BigInteger;
+
+// creation
+BigInteger big_integer_from_int64(int64_t value);
+// the integer part of value, exactly; value must be finite
+BigInteger big_integer_from_double(double value);
+
+// lifecycle
+BigInteger copy_big_integer(const BigInteger *a);
+void free_big_integer(BigInteger *a);
+
+// arithmetic
+BigInteger big_integer_add(const BigInteger *a, const BigInteger *b);
+BigInteger big_integer_subtract(const BigInteger *a, const BigInteger *b);
+BigInteger big_integer_multiply(const BigInteger *a, const BigInteger *b);
+BigInteger big_integer_negate(const BigInteger *a);
+// a * 2^bits for bits >= 0
+BigInteger big_integer_shift_left(const BigInteger *a, int bits);
+// truncating division, a = quotient * b + remainder with the remainder taking a's
+// sign; b must be nonzero and either output may be NULL
+void big_integer_divide(const BigInteger *a, const BigInteger *b, BigInteger *quotient, BigInteger *remainder);
+// non-negative; gcd(0, 0) = 0
+BigInteger big_integer_gcd(const BigInteger *a, const BigInteger *b);
+
+// comparison & conversion
+int big_integer_compare(const BigInteger *a, const BigInteger *b);
+bool big_integer_is_zero(const BigInteger *a);
+bool big_integer_is_one(const BigInteger *a);
+// position of the highest set bit plus one; 0 for zero
+int big_integer_bit_length(const BigInteger *a);
+// nearest double up to one unit in the last place; infinite past the double range
+double big_integer_to_double(const BigInteger *a);
+// a 2^exponent rounded the same way, without overflowing on the way for large a
+double big_integer_to_double_scaled(const BigInteger *a, int exponent);
+
+#endif // BIG_INTEGER_H
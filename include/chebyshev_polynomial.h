@@ -0,0 +1,34 @@
+#ifndef CHEBYSHEV_POLYNOMIAL_H
+#define CHEBYSHEV_POLYNOMIAL_H
+
+#include <stddef.h>
+
+#include "polynomial.h"
+
+// sum coefficients[k] T_k(t) with t = (2x - lower - upper) / (upper - lower),
+// so the basis is well conditioned on [lower, upper]
+typedef struct
+{
+    int degree;
+    double *coefficients;
+
+    double lower;
+    double upper;
+} ChebyshevPolynomial;
+
+// lifecycle
+ChebyshevPolynomial chebyshev_from_polynomial(const Polynomial *p, double lower, double upper);
+Polynomial chebyshev_to_polynomial(const ChebyshevPolynomial *c);
+ChebyshevPolynomial copy_chebyshev_polynomial(const ChebyshevPolynomial *c);
+void free_chebyshev_polynomial(ChebyshevPolynomial *c);
+
+// evaluation & calculus (Clenshaw's recurrence)
+double chebyshev_evaluate(const ChebyshevPolynomial *c, double x);
+void chebyshev_evaluate_many(const ChebyshevPolynomial *c, const double *xs, double *ys, size_t n);
+ChebyshevPolynomial chebyshev_derivative(const ChebyshevPolynomial *c);
+
+// drops the highest terms while their total magnitude stays within tolerance; since
+// |T_k| <= 1 on the interval, the result is within tolerance of c there
+ChebyshevPolynomial chebyshev_truncate(const ChebyshevPolynomial *c, double tolerance);
+
+#endif // CHEBYSHEV_POLYNOMIAL_H
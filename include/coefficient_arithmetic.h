@@ -0,0 +1,55 @@
+// coefficient_arithmetic.h
+#ifndef COEFFICIENT_ARITHMETIC_H
+#define COEFFICIENT_ARITHMETIC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Raw coefficient arrays, lowest power first. These back the Polynomial arithmetic
+// and the internal algorithms that work on bare buffers.
+
+// out[0 .. a_len + b_len - 2] = a * b; out must not overlap the inputs.
+// Schoolbook below KARATSUBA_THRESHOLD coefficients, Karatsuba above and FFT from
+// FFT_THRESHOLD on; operands the FFT declines fall back to schoolbook.
+// The schoolbook and FFT products keep each coefficient accurate relative to its own
+// sum of |a_i b_j|. Karatsuba's error is normwise instead: within about n u of the
+// largest such sum, so coefficients far below it can lose their relative accuracy.
+void coefficients_multiply(const double *a, size_t a_len, const double *b, size_t b_len, double *out);
+
+// Shorter operand length at which coefficients_multiply switches to Karatsuba
+#define KARATSUBA_THRESHOLD 32
+
+// out = a * b through a floating point FFT. Each operand is split into magnitude bands
+// so small coefficients keep their relative accuracy. Returns false, leaving out
+// untouched, when an operand is zero or spans too many binary orders of magnitude.
+bool coefficients_multiply_fft(const double *a, size_t a_len, const double *b, size_t b_len, double *out);
+
+// Shorter operand length at which coefficients_multiply tries the FFT
+#define FFT_THRESHOLD 2048
+
+// Exact out = a * b for integer-valued coefficients, rounded only where a result
+// coefficient needs more than 53 bits. Returns false, leaving out untouched, when a
+// coefficient is not an integer or the products could reach 2^123.
+bool coefficients_multiply_integer(const double *a, size_t a_len, const double *b, size_t b_len, double *out);
+
+// out = a * b by number-theoretic transforms modulo one or two 62-bit primes, with
+// the residues combined by the Chinese remainder theorem. Every coefficient of the
+// product must be below 2^bits in magnitude; false when bits exceeds 123.
+bool coefficients_multiply_ntt(const double *a, size_t a_len, const double *b, size_t b_len, int bits, double *out);
+
+// Shorter operand length at which coefficients_multiply_integer prefers the NTT even
+// when the schoolbook product would be exact
+#define NTT_THRESHOLD 256
+
+// quotient[0 .. a_len - b_len] and remainder[0 .. b_len - 2] of a / b, for
+// a_len >= b_len and a nonzero leading b. Long division below
+// NEWTON_DIVISION_THRESHOLD; above, the quotient comes from Newton's iteration for
+// the power series inverse of the reversed divisor, so the cost is a few
+// multiplications rather than (a_len - b_len + 1) b_len operations.
+void coefficients_divide(const double *a, size_t a_len, const double *b, size_t b_len, double *quotient,
+                         double *remainder);
+
+// Quotient and divisor length from which coefficients_divide uses Newton's iteration
+#define NEWTON_DIVISION_THRESHOLD 8192
+
+#endif // COEFFICIENT_ARITHMETIC_H
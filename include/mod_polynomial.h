@@ -0,0 +1,54 @@
+// mod_polynomial.h
+#ifndef MOD_POLYNOMIAL_H
+#define MOD_POLYNOMIAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "polynomial.h"
+
+// Polynomial over the integers modulo a prime below 2^62, lowest power first, each
+// coefficient in [0, modulus). The degree is trimmed after every operation; zero is
+// degree 0 with a zero coefficient. Operands of one operation share their modulus.
+typedef struct
+{
+    uint64_t modulus;
+    int degree;
+    uint64_t *coefficients;
+} ModPolynomial;
+
+// The largest primes below 2^62, for callers that need a few independent moduli
+#define MOD_POLYNOMIAL_PRIME_COUNT 4
+extern const uint64_t mod_polynomial_primes[MOD_POLYNOMIAL_PRIME_COUNT];
+
+// residues
+// x rounded to the nearest integer, mod modulus in [0, modulus), for any magnitude
+uint64_t mod_from_double(double x, uint64_t modulus);
+uint64_t mod_multiply(uint64_t a, uint64_t b, uint64_t modulus);
+// a^-1 mod modulus for a not divisible by it
+uint64_t mod_inverse(uint64_t a, uint64_t modulus);
+
+// creation
+ModPolynomial create_mod_polynomial(const uint64_t *coefficients, int degree, uint64_t modulus);
+// p reduced coefficientwise, each coefficient rounded to the nearest integer
+ModPolynomial mod_polynomial_from_polynomial(const Polynomial *p, uint64_t modulus);
+
+// lifecycle
+ModPolynomial copy_mod_polynomial(const ModPolynomial *p);
+void free_mod_polynomial(ModPolynomial *p);
+
+// arithmetic
+ModPolynomial mod_polynomial_add(const ModPolynomial *p1, const ModPolynomial *p2);
+ModPolynomial mod_polynomial_subtract(const ModPolynomial *p1, const ModPolynomial *p2);
+ModPolynomial mod_polynomial_multiply(const ModPolynomial *p1, const ModPolynomial *p2);
+ModPolynomial mod_polynomial_derivative(const ModPolynomial *p);
+// quotient and, in rest, the remainder of p1 / p2 for nonzero p2
+ModPolynomial mod_polynomial_divide(const ModPolynomial *p1, const ModPolynomial *p2, ModPolynomial *rest);
+// monic gcd; gcd(0, 0) = 0
+ModPolynomial mod_polynomial_gcd(const ModPolynomial *p1, const ModPolynomial *p2);
+
+// evaluation
+bool mod_polynomial_is_zero(const ModPolynomial *p);
+uint64_t mod_polynomial_evaluate(const ModPolynomial *p, uint64_t x);
+
+#endif // MOD_POLYNOMIAL_H
@@ -1,6 +1,8 @@
 #ifndef PLOT_H
 #define PLOT_H
 
+#include "polynomial.h"
+
 typedef double (*Function)(double x);
 
 // Plots y = f(x) into an RGB buffer
@@ -16,4 +18,17 @@ void plot_function(
     int thickness
 );
 
+// Plots y = p(x) into an RGB buffer, evaluating all pixel columns in one batch
+void plot_polynomial(
+    unsigned char *image,
+    int width,
+    int height,
+    const Polynomial *p,
+    double xmin,
+    double xmax,
+    double ymin,
+    double ymax,
+    int thickness
+);
+
 #endif // PLOT_H
@@ -18,6 +18,8 @@ typedef struct
 
     int degree;
     double *coefficients;
+    // coefficient slots owned by this polynomial; 0 when coefficients is borrowed
+    int capacity;
 
     RootArrayList roots;
 
@@ -36,6 +38,46 @@ typedef struct
 
 } Polynomial;
 
+// One factor of a square-free decomposition and the power it divides p to
+typedef struct
+{
+    Polynomial factor;
+    int multiplicity;
+} SquareFreeFactor;
+
+typedef struct
+{
+    SquareFreeFactor *factors;
+    int count;
+} SquareFreeDecomposition;
+
+typedef enum
+{
+    SIMD_LEVEL_SCALAR,
+    SIMD_LEVEL_SSE2,
+    SIMD_LEVEL_AVX2,
+    SIMD_LEVEL_AVX512
+} SimdLevel;
+
+typedef enum
+{
+    EVALUATION_AUTO,
+    EVALUATION_HORNER,
+    EVALUATION_ESTRIN,
+    EVALUATION_COMPENSATED
+} EvaluationScheme;
+
+// Order of synthetic division. Forward runs from the leading coefficient down and is
+// stable for factors with small roots, backward runs from the constant up and is
+// stable for large ones; DEFLATION_AUTO picks by the magnitude of the factor's
+// constant term.
+typedef enum
+{
+    DEFLATION_AUTO,
+    DEFLATION_FORWARD,
+    DEFLATION_BACKWARD
+} DeflationDirection;
+
 // creation
 Polynomial create_polynomial_from_formula(
     const char *formula,
@@ -50,11 +92,41 @@ Polynomial create_binomial(int degree, double coefficient);
 // lifecycle
 Polynomial copy_polynomial(const Polynomial *p);
 void free_polynomial(Polynomial *p);
+// room for degree + 1 coefficients, keeping the current ones; a borrowed array is
+// copied rather than reallocated
+void polynomial_reserve(Polynomial *p, int degree);
 
 // evaluation & calculus
 double polynomial_evaluate(const Polynomial *p, double x);
+// EVALUATION_AUTO picks Estrin's scheme for high degrees and Horner otherwise;
+// EVALUATION_COMPENSATED is about twice as accurate at roughly three times the cost
+double polynomial_evaluate_with_scheme(const Polynomial *p, double x, EvaluationScheme scheme);
+// sign of p(x); falls back to compensated evaluation when Horner's error bound cannot decide it
+int polynomial_sign_at(const Polynomial *p, double x);
+// a priori bound on the rounding error of Horner's scheme at x
+double polynomial_evaluation_error_bound(const Polynomial *p, double x);
+// writes p(x), p'(x), ..., p^(k)(x) to out[0..k] using a single pass over the coefficients
+void polynomial_evaluate_with_derivatives(const Polynomial *p, double x, int k, double *out);
+// batch evaluation: ys[i] = p(xs[i]) with the widest vector kernel the CPU supports
+void polynomial_evaluate_many(const Polynomial *p, const double *xs, double *ys, size_t n);
+// same, forcing a kernel (clamped to what the CPU supports); SIMD_LEVEL_SCALAR is the reference path
+void polynomial_evaluate_many_at_level(const Polynomial *p, const double *xs, double *ys, size_t n, SimdLevel level);
+SimdLevel polynomial_simd_level(void);
+// float evaluation with twice the lanes; returns an a priori bound on |ys[i] - p(xs[i])|
+// valid for every point, so callers can fall back to double only where it matters
+double polynomial_evaluate_many_float(const Polynomial *p, const double *xs, double *ys, size_t n);
+// out[i] = p(x0 + i * dx) by forward differences, re-synchronised before the drift
+// exceeds a small multiple of Horner's rounding error
+void polynomial_evaluate_grid(const Polynomial *p, double x0, double dx, size_t count, double *out);
+// rigorous enclosure of p over the closed hull of x (outward rounded natural and
+// mean value forms, intersected); the whole real line when a bound is infinite
+Interval polynomial_evaluate_interval(const Polynomial *p, Interval x);
+// true when the enclosure proves p has no zero on x
+bool polynomial_interval_excludes_zero(const Polynomial *p, Interval x);
+
 ExtendedValue polynomial_limit(const Polynomial *p, ExtendedValue approach);
 Polynomial polynomial_derivative(const Polynomial *p);
+void polynomial_derivative_into(Polynomial *dst, const Polynomial *p);
 
 // arithmetic
 Polynomial polynomial_add(const Polynomial *p1, const Polynomial *p2);
@@ -62,11 +134,55 @@ Polynomial polynomial_subtract(const Polynomial *p1, const Polynomial *p2);
 Polynomial polynomial_multiply(const Polynomial *p1, const Polynomial *p2);
 Polynomial polynomial_scalar_multiply(const Polynomial *p, double scalar);
 
+// In-place forms: the result overwrites dst's coefficients, growing them only past
+// its capacity. The formula and analysis fields are neither built nor updated, so
+// dst may start zero-initialised; dst may alias an operand.
+void polynomial_add_into(Polynomial *dst, const Polynomial *p1, const Polynomial *p2);
+void polynomial_subtract_into(Polynomial *dst, const Polynomial *p1, const Polynomial *p2);
+void polynomial_multiply_into(Polynomial *dst, const Polynomial *p1, const Polynomial *p2);
+void polynomial_scale_in_place(Polynomial *p, double scalar);
+
+// p^k for k >= 0 by repeated squaring on the fastest multiplication available; a
+// negative k gives the zero polynomial
+Polynomial polynomial_pow(const Polynomial *p, int k);
+// the terms of p^k up to degree max_degree, zero for negative k or max_degree. Each
+// product is still formed in full, up to 2 max_degree + 1 coefficients, and then cut
+// back, so the operands of the next product hold at most max_degree + 1.
+Polynomial polynomial_pow_truncated(const Polynomial *p, int k, int max_degree);
+
+// Synthetic division in place, O(degree) and without allocation; the analysis fields
+// are left alone. Returns what is left over, which vanishes for an exact factor: the
+// remainder p(root) going forward, the mismatch in the leading coefficient going
+// backward.
+double polynomial_deflate_linear(Polynomial *p, double root, DeflationDirection direction);
+// same for x^2 + b x + c; left_over[0..1] receives the two leftover terms when non-null
+void polynomial_deflate_quadratic(Polynomial *p, double b, double c, DeflationDirection direction,
+                                  double *left_over);
+
 Polynomial polynomial_divide(
     const Polynomial *p1,
     const Polynomial *p2,
     Polynomial *rest);
 
+// p(q(x)). Short p runs Horner's rule; long p splits as low + q^m high with the powers
+// q^(2^k) shared by every level, so the cost follows fast multiplication.
+Polynomial polynomial_compose(const Polynomial *p, const Polynomial *q);
+// p(x + a): the in-place quadratic shift for short p, the split above for long p.
+// The split's rounding error is relative to the largest coefficients of the result
+// rather than to each one, which matters only when shifting causes heavy cancellation.
+Polynomial polynomial_taylor_shift(const Polynomial *p, double a);
+
+// Greatest common divisor. Integer operands get the exact primitive gcd with a
+// positive leading coefficient, as long as the remainder sequence stays below 2^53;
+// otherwise the result is monic, with remainders below a relative tolerance taken as
+// zero. gcd(0, 0) is the zero polynomial.
+Polynomial polynomial_gcd(const Polynomial *p1, const Polynomial *p2);
+
+// p as a constant times the product of factor^multiplicity over pairwise coprime,
+// square-free factors of degree one or more, in increasing multiplicity
+SquareFreeDecomposition polynomial_square_free_decomposition(const Polynomial *p);
+void free_square_free_decomposition(SquareFreeDecomposition *d);
+
 // analysis
 void polynomial_find_properties(Polynomial *p);
 
@@ -79,7 +195,6 @@ void polynomial_to_string(const Polynomial *p, char *buffer, int buffer_size);
 // numeric methods
 double newton_raphson_polynomial(
     const Polynomial *p, 
-    const Polynomial *prime, 
     double x0, 
     double tol, 
     int max_iter);
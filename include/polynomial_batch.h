@@ -0,0 +1,26 @@
+#ifndef POLYNOMIAL_BATCH_H
+#define POLYNOMIAL_BATCH_H
+
+#include <stddef.h>
+
+#include "polynomial.h"
+
+typedef struct
+{
+    int count;
+    int max_degree;
+
+    // coefficient of x^j of polynomial i is at coefficients[i * (max_degree + 1) + j],
+    // zero padded up to max_degree
+    double *coefficients;
+} PolynomialBatch;
+
+// lifecycle
+PolynomialBatch create_polynomial_batch(const Polynomial *polynomials, int count);
+void free_polynomial_batch(PolynomialBatch *batch);
+
+// out[i * m + k] = p_i(xs[k]); the powers of each tile of points are built once and
+// shared by every polynomial, so the work is a blocked matrix product
+void polynomial_batch_evaluate(const PolynomialBatch *batch, const double *xs, size_t m, double *out);
+
+#endif // POLYNOMIAL_BATCH_H
@@ -0,0 +1,28 @@
+// polynomial_kernels.h
+#ifndef POLYNOMIAL_KERNELS_H
+#define POLYNOMIAL_KERNELS_H
+
+#include <math.h>
+
+// One Horner step, fused when the target has a fast hardware fma
+#ifdef FP_FAST_FMA
+#define HORNER_STEP(acc, x, c) fma((acc), (x), (c))
+#else
+#define HORNER_STEP(acc, x, c) ((acc) * (x) + (c))
+#endif
+
+// Degrees with a fully unrolled value kernel; above it Estrin's scheme is faster
+#define POLYNOMIAL_KERNEL_MAX_DEGREE 16
+
+// Degrees with a fully unrolled value and derivative kernel
+#define POLYNOMIAL_DERIVATIVE_KERNEL_MAX_DEGREE 32
+
+typedef double (*EvaluationKernel)(const double *coefficients, double x);
+typedef void (*EvaluationDerivativeKernel)(const double *coefficients, double x, double *value, double *derivative);
+
+// indexed by degree up to the matching maximum; the results are bit-identical to the
+// Horner loop they replace
+extern const EvaluationKernel polynomial_evaluation_kernels[POLYNOMIAL_KERNEL_MAX_DEGREE + 1];
+extern const EvaluationDerivativeKernel polynomial_derivative_kernels[POLYNOMIAL_DERIVATIVE_KERNEL_MAX_DEGREE + 1];
+
+#endif // POLYNOMIAL_KERNELS_H
@@ -0,0 +1,44 @@
+// rational.h
+#ifndef RATIONAL_H
+#define RATIONAL_H
+
+#include <stdbool.h>
+
+#include "big_integer.h"
+
+// Exact rational number in lowest terms with a positive denominator. Operations
+// return newly allocated values, released with free_rational.
+typedef struct
+{
+    BigInteger numerator;
+    BigInteger denominator;
+} Rational;
+
+// creation
+Rational rational_from_integer(long long value);
+// the exact value of a finite double, which is always a dyadic rational
+Rational rational_from_double(double value);
+// numerator / denominator reduced; takes ownership of both, denominator nonzero
+Rational create_rational(BigInteger numerator, BigInteger denominator);
+
+// lifecycle
+Rational copy_rational(const Rational *a);
+void free_rational(Rational *a);
+
+// arithmetic
+Rational rational_add(const Rational *a, const Rational *b);
+Rational rational_subtract(const Rational *a, const Rational *b);
+Rational rational_multiply(const Rational *a, const Rational *b);
+// b must be nonzero
+Rational rational_divide(const Rational *a, const Rational *b);
+Rational rational_negate(const Rational *a);
+
+// comparison & conversion
+int rational_sign(const Rational *a);
+int rational_compare(const Rational *a, const Rational *b);
+bool rational_is_zero(const Rational *a);
+bool rational_is_integer(const Rational *a);
+// nearest double up to a couple of units in the last place
+double rational_to_double(const Rational *a);
+
+#endif // RATIONAL_H
@@ -0,0 +1,51 @@
+// rational_polynomial.h
+#ifndef RATIONAL_POLYNOMIAL_H
+#define RATIONAL_POLYNOMIAL_H
+
+#include <stdbool.h>
+
+#include "rational.h"
+#include "polynomial.h"
+
+// Polynomial with exact rational coefficients, lowest power first. The degree is
+// trimmed after every operation; zero is degree 0 with a zero coefficient.
+typedef struct
+{
+    int degree;
+    Rational *coefficients;
+} RationalPolynomial;
+
+// creation
+RationalPolynomial create_rational_polynomial(const Rational *coefficients, int degree);
+// exact: every double is a rational
+RationalPolynomial rational_polynomial_from_polynomial(const Polynomial *p);
+// coefficients rounded to the nearest doubles
+Polynomial rational_polynomial_to_polynomial(const RationalPolynomial *p);
+
+// lifecycle
+RationalPolynomial copy_rational_polynomial(const RationalPolynomial *p);
+void free_rational_polynomial(RationalPolynomial *p);
+
+// arithmetic
+RationalPolynomial rational_polynomial_add(const RationalPolynomial *p1, const RationalPolynomial *p2);
+RationalPolynomial rational_polynomial_subtract(const RationalPolynomial *p1, const RationalPolynomial *p2);
+RationalPolynomial rational_polynomial_multiply(const RationalPolynomial *p1, const RationalPolynomial *p2);
+RationalPolynomial rational_polynomial_derivative(const RationalPolynomial *p);
+// quotient and, in rest, the remainder of p1 / p2 for nonzero p2
+RationalPolynomial rational_polynomial_divide(const RationalPolynomial *p1, const RationalPolynomial *p2,
+                                              RationalPolynomial *rest);
+// the positive multiple of p with coprime integer coefficients
+RationalPolynomial rational_polynomial_primitive_part(const RationalPolynomial *p);
+
+// The Sturm sequence of a polynomial with integer coefficients by the subresultant
+// remainder sequence: every division is exact, so members stay integral and grow
+// only polynomially without any gcd, and each is a positive multiple of the
+// classical member. Writes up to degree + 1 members and returns their count.
+int rational_polynomial_subresultant_sturm(const RationalPolynomial *p, RationalPolynomial *members);
+
+// evaluation
+bool rational_polynomial_is_zero(const RationalPolynomial *p);
+// exact sign of p(x)
+int rational_polynomial_sign_at(const RationalPolynomial *p, double x);
+
+#endif // RATIONAL_POLYNOMIAL_H
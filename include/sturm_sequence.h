@@ -5,16 +5,42 @@
 #include <math.h>
 
 #include "polynomial.h"
+#include "rational_polynomial.h"
 #include "interval.h"
 
+// Degree above which create_sturm_sequence builds the chain in exact arithmetic; the
+// floating point remainder sequence loses real roots past it
+#define STURM_EXACT_DEGREE 15
+
 typedef struct
 {
     Polynomial *polynomials;
     int count;
+
+    // all members in one block: coefficient of x^j of member i is at
+    // packed_coefficients[j * count + i], zero padded up to max_degree
+    int max_degree;
+    double *packed_coefficients;
+
+    // float copy of the packed block for a first sweep with twice the lanes;
+    // NULL when some coefficient is outside the normal float range
+    float *packed_float_coefficients;
+
+    // exact members of a chain built over the rationals, which settle the signs that
+    // floating point evaluation of the rounded members cannot; NULL otherwise
+    RationalPolynomial *exact_polynomials;
+
+    // sign changes at -Inf and +Inf, fixed at construction
+    int sign_changes_at_neg_inf;
+    int sign_changes_at_pos_inf;
 } SturmSequence;
 
 // lifecycle
 SturmSequence create_sturm_sequence(const Polynomial *p);
+// the chain of p's exact rational value, each member a positive multiple of the
+// classical one with coprime integer coefficients; polynomials hold them rounded
+// after scaling by a power of two
+SturmSequence create_exact_sturm_sequence(const Polynomial *p);
 void free_sturm_sequence(SturmSequence *sequence);
 
 // analysis
@@ -0,0 +1,149 @@
+// uint128.h
+#ifndef UINT128_H
+#define UINT128_H
+
+#include <stdint.h>
+#include <math.h>
+
+// Unsigned 128-bit values for the word-size modular arithmetic. The products and
+// divisions use unsigned __int128 where GCC and Clang have it, the MSVC intrinsics
+// on x64, and 32-bit halves anywhere else.
+
+#if defined(__SIZEOF_INT128__)
+#define UINT128_NATIVE 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define UINT128_MSVC 1
+#include <intrin.h>
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+#define UINT128_MSVC_UMULH 1
+#include <intrin.h>
+#endif
+
+typedef struct
+{
+    uint64_t low;
+    uint64_t high;
+} Uint128;
+
+#ifdef UINT128_NATIVE
+// __extension__ keeps -Wpedantic quiet about the GCC and Clang type
+__extension__ typedef unsigned __int128 NativeUint128;
+#endif
+
+// a * b in full
+static inline Uint128 uint128_multiply(uint64_t a, uint64_t b)
+{
+    Uint128 result;
+
+#if defined(UINT128_NATIVE)
+    NativeUint128 product = (NativeUint128)a * b;
+    result.low = (uint64_t)product;
+    result.high = (uint64_t)(product >> 64);
+#elif defined(UINT128_MSVC)
+    result.low = _umul128(a, b, &result.high);
+#elif defined(UINT128_MSVC_UMULH)
+    result.low = a * b;
+    result.high = __umulh(a, b);
+#else
+    uint64_t a_low = a & 0xffffffffu, a_high = a >> 32;
+    uint64_t b_low = b & 0xffffffffu, b_high = b >> 32;
+
+    uint64_t low_low = a_low * b_low;
+    uint64_t high_low = a_high * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t high_high = a_high * b_high;
+
+    // the middle column fits: low_high is at most 2^64 - 2^33 + 1, the others below 2^32
+    uint64_t middle = (low_low >> 32) + (high_low & 0xffffffffu) + low_high;
+
+    result.low = (middle << 32) | (low_low & 0xffffffffu);
+    result.high = high_high + (high_low >> 32) + (middle >> 32);
+#endif
+
+    return result;
+}
+
+// the upper word of a * b
+static inline uint64_t uint128_multiply_high(uint64_t a, uint64_t b)
+{
+    return uint128_multiply(a, b).high;
+}
+
+static inline Uint128 uint128_add(Uint128 a, Uint128 b)
+{
+    Uint128 sum = {.low = a.low + b.low};
+    sum.high = a.high + b.high + (sum.low < a.low);
+    return sum;
+}
+
+static inline Uint128 uint128_subtract(Uint128 a, Uint128 b)
+{
+    Uint128 difference = {.low = a.low - b.low};
+    difference.high = a.high - b.high - (a.low < b.low);
+    return difference;
+}
+
+static inline int uint128_less(Uint128 a, Uint128 b)
+{
+    return a.high < b.high || (a.high == b.high && a.low < b.low);
+}
+
+// x / divisor for x.high < divisor, so the quotient fits a word; the remainder goes
+// to remainder when it is not NULL
+static inline uint64_t uint128_divide(Uint128 x, uint64_t divisor, uint64_t *remainder)
+{
+    uint64_t quotient;
+    uint64_t rest;
+
+#if defined(UINT128_NATIVE)
+    NativeUint128 value = ((NativeUint128)x.high << 64) | x.low;
+    quotient = (uint64_t)(value / divisor);
+    rest = (uint64_t)(value % divisor);
+#elif defined(UINT128_MSVC)
+    quotient = _udiv128(x.high, x.low, divisor, &rest);
+#else
+    // restoring division, one quotient bit per step; the quotient fills low as the
+    // dividend shifts out of it
+    rest = x.high;
+    quotient = x.low;
+
+    for (int i = 0; i < 64; i++)
+    {
+        uint64_t carry = rest >> 63;
+
+        rest = (rest << 1) | (quotient >> 63);
+        quotient <<= 1;
+
+        if (carry || rest >= divisor)
+        {
+            rest -= divisor;
+            quotient |= 1;
+        }
+    }
+#endif
+
+    if (remainder)
+        *remainder = rest;
+
+    return quotient;
+}
+
+// x rounded to the nearest double
+static inline double uint128_to_double(Uint128 x)
+{
+    if (x.high == 0)
+        return (double)x.low;
+
+    int shift = 0;
+    while (shift < 64 && (x.high >> shift) != 0)
+        shift++;
+
+    // the top 64 bits, with a sticky bit for everything below them well under the
+    // rounding position, so the one conversion rounds correctly
+    uint64_t top = (shift == 64) ? x.high : (x.high << (64 - shift)) | (x.low >> shift);
+    uint64_t below = (shift == 64) ? x.low : x.low << (64 - shift);
+
+    return ldexp((double)(top | (below != 0)), shift);
+}
+
+#endif // UINT128_H
@@ -0,0 +1,457 @@
+// big_integer.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "big_integer.h"
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static uint32_t *allocate_limbs(int count)
+{
+    return allocate_or_exit((count > 0 ? count : 1) * sizeof(uint32_t));
+}
+
+// takes ownership of limbs and drops leading zero limbs
+static BigInteger create_big_integer(int sign, uint32_t *limbs, int size)
+{
+    while (size > 0 && limbs[size - 1] == 0)
+        size--;
+
+    if (size == 0)
+    {
+        free(limbs);
+        return (BigInteger){.sign = 0, .size = 0, .limbs = NULL};
+    }
+
+    return (BigInteger){.sign = sign, .size = size, .limbs = limbs};
+}
+
+static BigInteger from_magnitude(int sign, uint64_t magnitude)
+{
+    uint32_t *limbs = allocate_limbs(2);
+    limbs[0] = (uint32_t)magnitude;
+    limbs[1] = (uint32_t)(magnitude >> 32);
+
+    return create_big_integer(sign, limbs, 2);
+}
+
+static int leading_zeros(uint32_t x)
+{
+    int count = 0;
+    for (; !(x & 0x80000000u); x <<= 1)
+        count++;
+    return count;
+}
+
+static int compare_magnitude(const uint32_t *a, int a_size, const uint32_t *b, int b_size)
+{
+    if (a_size != b_size)
+        return (a_size > b_size) ? 1 : -1;
+
+    for (int i = a_size - 1; i >= 0; i--)
+        if (a[i] != b[i])
+            return (a[i] > b[i]) ? 1 : -1;
+
+    return 0;
+}
+
+static BigInteger add_magnitude(int sign, const uint32_t *a, int a_size, const uint32_t *b, int b_size)
+{
+    if (a_size < b_size)
+    {
+        const uint32_t *swap = a;
+        a = b;
+        b = swap;
+
+        int swap_size = a_size;
+        a_size = b_size;
+        b_size = swap_size;
+    }
+
+    uint32_t *sum = allocate_limbs(a_size + 1);
+    uint64_t carry = 0;
+
+    for (int i = 0; i < a_size; i++)
+    {
+        carry += (uint64_t)a[i] + (i < b_size ? b[i] : 0);
+        sum[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    sum[a_size] = (uint32_t)carry;
+
+    return create_big_integer(sign, sum, a_size + 1);
+}
+
+// |a| - |b| for |a| >= |b|
+static BigInteger subtract_magnitude(int sign, const uint32_t *a, int a_size, const uint32_t *b, int b_size)
+{
+    uint32_t *difference = allocate_limbs(a_size);
+    int64_t borrow = 0;
+
+    for (int i = 0; i < a_size; i++)
+    {
+        int64_t t = (int64_t)a[i] - (i < b_size ? b[i] : 0) - borrow;
+        borrow = t < 0;
+        difference[i] = (uint32_t)(t + (borrow << 32));
+    }
+
+    return create_big_integer(sign, difference, a_size);
+}
+
+// a + sign_b b, with the magnitudes ordered to decide which one survives
+static BigInteger add_signed(const BigInteger *a, const BigInteger *b, int sign_b)
+{
+    if (b->sign == 0)
+        return copy_big_integer(a);
+
+    if (a->sign == 0)
+    {
+        BigInteger result = copy_big_integer(b);
+        result.sign *= sign_b;
+        return result;
+    }
+
+    int b_sign = b->sign * sign_b;
+
+    if (a->sign == b_sign)
+        return add_magnitude(a->sign, a->limbs, a->size, b->limbs, b->size);
+
+    int order = compare_magnitude(a->limbs, a->size, b->limbs, b->size);
+
+    if (order == 0)
+        return big_integer_from_int64(0);
+
+    if (order > 0)
+        return subtract_magnitude(a->sign, a->limbs, a->size, b->limbs, b->size);
+
+    return subtract_magnitude(b_sign, b->limbs, b->size, a->limbs, a->size);
+}
+
+// Knuth's algorithm D on 32-bit limbs: quotient[0 .. a_size - b_size] and
+// remainder[0 .. b_size - 1] of a / b, for a_size >= b_size and a nonzero top limb in b
+static void divide_magnitude(const uint32_t *a, int a_size, const uint32_t *b, int b_size, uint32_t *quotient,
+                             uint32_t *remainder)
+{
+    if (b_size == 1)
+    {
+        uint64_t rest = 0;
+
+        for (int i = a_size - 1; i >= 0; i--)
+        {
+            uint64_t current = (rest << 32) | a[i];
+            quotient[i] = (uint32_t)(current / b[0]);
+            rest = current % b[0];
+        }
+
+        remainder[0] = (uint32_t)rest;
+        return;
+    }
+
+    // normalise so the divisor's top bit is set, which keeps each trial quotient
+    // digit at most two too large
+    int s = leading_zeros(b[b_size - 1]);
+
+    uint32_t *v = allocate_limbs(b_size);
+    uint32_t *u = allocate_limbs(a_size + 1);
+
+    for (int i = b_size - 1; i > 0; i--)
+        v[i] = (b[i] << s) | (uint32_t)((uint64_t)b[i - 1] >> (32 - s));
+    v[0] = b[0] << s;
+
+    u[a_size] = (uint32_t)((uint64_t)a[a_size - 1] >> (32 - s));
+    for (int i = a_size - 1; i > 0; i--)
+        u[i] = (a[i] << s) | (uint32_t)((uint64_t)a[i - 1] >> (32 - s));
+    u[0] = a[0] << s;
+
+    const uint64_t base = (uint64_t)1 << 32;
+
+    for (int j = a_size - b_size; j >= 0; j--)
+    {
+        uint64_t numerator = ((uint64_t)u[j + b_size] << 32) | u[j + b_size - 1];
+        uint64_t q = numerator / v[b_size - 1];
+        uint64_t r = numerator % v[b_size - 1];
+
+        while (q >= base || q * v[b_size - 2] > ((r << 32) | u[j + b_size - 2]))
+        {
+            q--;
+            r += v[b_size - 1];
+            if (r >= base)
+                break;
+        }
+
+        // u[j .. j + b_size] -= q v
+        int64_t borrow = 0;
+        int64_t t;
+
+        for (int i = 0; i < b_size; i++)
+        {
+            uint64_t product = q * v[i];
+            t = (int64_t)u[i + j] - borrow - (int64_t)(product & 0xFFFFFFFFu);
+            u[i + j] = (uint32_t)t;
+            borrow = (int64_t)(product >> 32) - (t >> 32);
+        }
+
+        t = (int64_t)u[j + b_size] - borrow;
+        u[j + b_size] = (uint32_t)t;
+
+        // the trial digit was one too large: add v back
+        if (t < 0)
+        {
+            q--;
+
+            uint64_t carry = 0;
+            for (int i = 0; i < b_size; i++)
+            {
+                carry += (uint64_t)u[i + j] + v[i];
+                u[i + j] = (uint32_t)carry;
+                carry >>= 32;
+            }
+            u[j + b_size] += (uint32_t)carry;
+        }
+
+        quotient[j] = (uint32_t)q;
+    }
+
+    for (int i = 0; i < b_size - 1; i++)
+        remainder[i] = (u[i] >> s) | (uint32_t)((uint64_t)u[i + 1] << (32 - s));
+    remainder[b_size - 1] = u[b_size - 1] >> s;
+
+    free(u);
+    free(v);
+}
+
+BigInteger big_integer_from_int64(int64_t value)
+{
+    if (value < 0)
+        return from_magnitude(-1, -(uint64_t)value);
+
+    return from_magnitude(1, (uint64_t)value);
+}
+
+BigInteger big_integer_from_double(double value)
+{
+    value = trunc(value);
+
+    if (value == 0.0)
+        return big_integer_from_int64(0);
+
+    int exponent;
+    double fraction = frexp(fabs(value), &exponent);
+
+    // |value| = mantissa 2^(exponent - 53) with a 53-bit mantissa
+    uint64_t mantissa = (uint64_t)ldexp(fraction, 53);
+    int sign = (value < 0) ? -1 : 1;
+
+    if (exponent <= 53)
+        return from_magnitude(sign, mantissa >> (53 - exponent));
+
+    BigInteger m = from_magnitude(sign, mantissa);
+    BigInteger result = big_integer_shift_left(&m, exponent - 53);
+    free_big_integer(&m);
+
+    return result;
+}
+
+BigInteger copy_big_integer(const BigInteger *a)
+{
+    uint32_t *limbs = allocate_limbs(a->size);
+    if (a->size > 0)
+        memcpy(limbs, a->limbs, a->size * sizeof(uint32_t));
+
+    return create_big_integer(a->sign, limbs, a->size);
+}
+
+void free_big_integer(BigInteger *a)
+{
+    free(a->limbs);
+    a->limbs = NULL;
+    a->size = 0;
+    a->sign = 0;
+}
+
+BigInteger big_integer_add(const BigInteger *a, const BigInteger *b)
+{
+    return add_signed(a, b, 1);
+}
+
+BigInteger big_integer_subtract(const BigInteger *a, const BigInteger *b)
+{
+    return add_signed(a, b, -1);
+}
+
+BigInteger big_integer_multiply(const BigInteger *a, const BigInteger *b)
+{
+    if (a->sign == 0 || b->sign == 0)
+        return big_integer_from_int64(0);
+
+    int size = a->size + b->size;
+    uint32_t *product = allocate_limbs(size);
+    memset(product, 0, size * sizeof(uint32_t));
+
+    for (int i = 0; i < a->size; i++)
+    {
+        uint64_t carry = 0;
+
+        for (int j = 0; j < b->size; j++)
+        {
+            carry += (uint64_t)a->limbs[i] * b->limbs[j] + product[i + j];
+            product[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+
+        product[i + b->size] = (uint32_t)carry;
+    }
+
+    return create_big_integer(a->sign * b->sign, product, size);
+}
+
+BigInteger big_integer_negate(const BigInteger *a)
+{
+    BigInteger result = copy_big_integer(a);
+    result.sign = -result.sign;
+    return result;
+}
+
+BigInteger big_integer_shift_left(const BigInteger *a, int bits)
+{
+    if (a->sign == 0)
+        return big_integer_from_int64(0);
+
+    int words = bits / 32;
+    int s = bits % 32;
+    int size = a->size + words + 1;
+
+    uint32_t *shifted = allocate_limbs(size);
+    memset(shifted, 0, words * sizeof(uint32_t));
+
+    uint32_t carry = 0;
+    for (int i = 0; i < a->size; i++)
+    {
+        shifted[i + words] = (a->limbs[i] << s) | carry;
+        carry = (uint32_t)((uint64_t)a->limbs[i] >> (32 - s));
+    }
+    shifted[a->size + words] = carry;
+
+    return create_big_integer(a->sign, shifted, size);
+}
+
+void big_integer_divide(const BigInteger *a, const BigInteger *b, BigInteger *quotient, BigInteger *remainder)
+{
+    if (compare_magnitude(a->limbs, a->size, b->limbs, b->size) < 0)
+    {
+        if (quotient)
+            *quotient = big_integer_from_int64(0);
+        if (remainder)
+            *remainder = copy_big_integer(a);
+        return;
+    }
+
+    uint32_t *q = allocate_limbs(a->size - b->size + 1);
+    uint32_t *r = allocate_limbs(b->size);
+
+    divide_magnitude(a->limbs, a->size, b->limbs, b->size, q, r);
+
+    if (quotient)
+        *quotient = create_big_integer(a->sign * b->sign, q, a->size - b->size + 1);
+    else
+        free(q);
+
+    if (remainder)
+        *remainder = create_big_integer(a->sign, r, b->size);
+    else
+        free(r);
+}
+
+BigInteger big_integer_gcd(const BigInteger *a, const BigInteger *b)
+{
+    BigInteger x = copy_big_integer(a);
+    BigInteger y = copy_big_integer(b);
+    x.sign = (x.sign != 0);
+    y.sign = (y.sign != 0);
+
+    while (y.sign != 0)
+    {
+        BigInteger r;
+        big_integer_divide(&x, &y, NULL, &r);
+
+        free_big_integer(&x);
+        x = y;
+        y = r;
+    }
+
+    return x;
+}
+
+int big_integer_compare(const BigInteger *a, const BigInteger *b)
+{
+    if (a->sign != b->sign)
+        return (a->sign > b->sign) ? 1 : -1;
+
+    return a->sign * compare_magnitude(a->limbs, a->size, b->limbs, b->size);
+}
+
+bool big_integer_is_zero(const BigInteger *a)
+{
+    return a->sign == 0;
+}
+
+bool big_integer_is_one(const BigInteger *a)
+{
+    return a->sign == 1 && a->size == 1 && a->limbs[0] == 1;
+}
+
+int big_integer_bit_length(const BigInteger *a)
+{
+    if (a->size == 0)
+        return 0;
+
+    return 32 * a->size - leading_zeros(a->limbs[a->size - 1]);
+}
+
+static uint32_t limb_at(const BigInteger *a, int i)
+{
+    return (i < a->size) ? a->limbs[i] : 0;
+}
+
+double big_integer_to_double(const BigInteger *a)
+{
+    return big_integer_to_double_scaled(a, 0);
+}
+
+double big_integer_to_double_scaled(const BigInteger *a, int exponent)
+{
+    int length = big_integer_bit_length(a);
+
+    if (length <= 64)
+    {
+        uint64_t magnitude = ((uint64_t)limb_at(a, 1) << 32) | limb_at(a, 0);
+        return a->sign * ldexp((double)magnitude, exponent);
+    }
+
+    // the top 64 bits, with the lowest one set when anything below is nonzero so
+    // the conversion to 53 bits rounds as if it saw every bit
+    int position = length - 64;
+    int word = position / 32;
+    int offset = position % 32;
+
+    uint64_t low = ((uint64_t)limb_at(a, word + 1) << 32) | limb_at(a, word);
+    uint64_t high = limb_at(a, word + 2);
+    uint64_t top = (low >> offset) | ((high << 1) << (63 - offset));
+
+    bool sticky = (limb_at(a, word) & ((1u << offset) - 1)) != 0;
+    for (int i = 0; i < word && !sticky; i++)
+        sticky = a->limbs[i] != 0;
+
+    return a->sign * ldexp((double)(top | sticky), position + exponent);
+}
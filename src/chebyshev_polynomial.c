@@ -0,0 +1,250 @@
+// chebyshev_polynomial.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "chebyshev_polynomial.h"
+
+// Points evaluated side by side in chebyshev_evaluate_many
+#define CHEBYSHEV_LANES 8
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static ChebyshevPolynomial allocate_chebyshev(int degree, double lower, double upper)
+{
+    ChebyshevPolynomial c = {.degree = degree, .lower = lower, .upper = upper};
+
+    c.coefficients = calloc(degree + 1, sizeof(double));
+    if (!c.coefficients)
+    {
+        perror("calloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    return c;
+}
+
+static double to_unit_interval(const ChebyshevPolynomial *c, double x)
+{
+    return (2.0 * x - c->lower - c->upper) / (c->upper - c->lower);
+}
+
+ChebyshevPolynomial chebyshev_from_polynomial(const Polynomial *p, double lower, double upper)
+{
+    int n = p->degree;
+    ChebyshevPolynomial c = allocate_chebyshev(n, lower, upper);
+
+    double mid = (lower + upper) / 2.0;
+    double half_width = (upper - lower) / 2.0;
+
+    double *product = allocate_or_exit((n + 1) * sizeof(double));
+
+    // Horner's scheme in x = mid + half_width * t, multiplying by t in the
+    // Chebyshev basis: t T_0 = T_1, t T_k = (T_(k+1) + T_(k-1)) / 2
+    int top = 0;
+    c.coefficients[0] = p->coefficients[n];
+
+    for (int i = n - 1; i >= 0; i--)
+    {
+        memset(product, 0, (top + 2) * sizeof(double));
+
+        product[1] += c.coefficients[0];
+        for (int k = 1; k <= top; k++)
+        {
+            product[k + 1] += c.coefficients[k] / 2.0;
+            product[k - 1] += c.coefficients[k] / 2.0;
+        }
+
+        for (int k = 0; k <= top; k++)
+            c.coefficients[k] = mid * c.coefficients[k] + half_width * product[k];
+        c.coefficients[top + 1] = half_width * product[top + 1];
+
+        c.coefficients[0] += p->coefficients[i];
+        top++;
+    }
+
+    free(product);
+
+    return c;
+}
+
+Polynomial chebyshev_to_polynomial(const ChebyshevPolynomial *c)
+{
+    int n = c->degree;
+
+    // t = offset + scale * x maps [lower, upper] onto [-1, 1]
+    double scale = 2.0 / (c->upper - c->lower);
+    double offset = -(c->lower + c->upper) / (c->upper - c->lower);
+
+    double *result = calloc(n + 1, sizeof(double));
+    double *previous = calloc(n + 1, sizeof(double));
+    double *current = calloc(n + 1, sizeof(double));
+    double *next = calloc(n + 1, sizeof(double));
+
+    if (!result || !previous || !current || !next)
+    {
+        perror("calloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    // monomial coefficients of T_(k-1) and T_k, from T_(k+1) = 2 t T_k - T_(k-1)
+    previous[0] = 1.0;
+    result[0] = c->coefficients[0];
+
+    if (n >= 1)
+    {
+        current[0] = offset;
+        current[1] = scale;
+
+        for (int j = 0; j <= 1; j++)
+            result[j] += c->coefficients[1] * current[j];
+    }
+
+    for (int k = 1; k < n; k++)
+    {
+        for (int j = 0; j <= k + 1; j++)
+        {
+            double shifted = (j > 0) ? current[j - 1] : 0.0;
+            next[j] = 2.0 * (offset * current[j] + scale * shifted) - previous[j];
+        }
+
+        for (int j = 0; j <= k + 1; j++)
+            result[j] += c->coefficients[k + 1] * next[j];
+
+        double *recycled = previous;
+        previous = current;
+        current = next;
+        next = recycled;
+    }
+
+    int degree = n;
+    while (degree > 0 && result[degree] == 0.0)
+        degree--;
+
+    Polynomial p = create_polynomial(result, degree);
+
+    free(result);
+    free(previous);
+    free(current);
+    free(next);
+
+    return p;
+}
+
+ChebyshevPolynomial copy_chebyshev_polynomial(const ChebyshevPolynomial *c)
+{
+    ChebyshevPolynomial copy = allocate_chebyshev(c->degree, c->lower, c->upper);
+    memcpy(copy.coefficients, c->coefficients, (c->degree + 1) * sizeof(double));
+    return copy;
+}
+
+void free_chebyshev_polynomial(ChebyshevPolynomial *c)
+{
+    free(c->coefficients);
+    c->coefficients = NULL;
+    c->degree = 0;
+}
+
+double chebyshev_evaluate(const ChebyshevPolynomial *c, double x)
+{
+    const double *a = c->coefficients;
+    double t = to_unit_interval(c, x);
+
+    double b1 = 0.0;
+    double b2 = 0.0;
+
+    for (int k = c->degree; k >= 1; k--)
+    {
+        double b0 = a[k] + 2.0 * t * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+
+    return a[0] + t * b1 - b2;
+}
+
+void chebyshev_evaluate_many(const ChebyshevPolynomial *c, const double *xs, double *ys, size_t n)
+{
+    const double *a = c->coefficients;
+    size_t i = 0;
+
+    // one Clenshaw recurrence per lane; the lane loops are independent and vectorize
+    for (; i + CHEBYSHEV_LANES <= n; i += CHEBYSHEV_LANES)
+    {
+        double t[CHEBYSHEV_LANES];
+        double b1[CHEBYSHEV_LANES] = {0.0};
+        double b2[CHEBYSHEV_LANES] = {0.0};
+
+        for (int lane = 0; lane < CHEBYSHEV_LANES; lane++)
+            t[lane] = to_unit_interval(c, xs[i + lane]);
+
+        for (int k = c->degree; k >= 1; k--)
+        {
+            for (int lane = 0; lane < CHEBYSHEV_LANES; lane++)
+            {
+                double b0 = a[k] + 2.0 * t[lane] * b1[lane] - b2[lane];
+                b2[lane] = b1[lane];
+                b1[lane] = b0;
+            }
+        }
+
+        for (int lane = 0; lane < CHEBYSHEV_LANES; lane++)
+            ys[i + lane] = a[0] + t[lane] * b1[lane] - b2[lane];
+    }
+
+    for (; i < n; i++)
+        ys[i] = chebyshev_evaluate(c, xs[i]);
+}
+
+ChebyshevPolynomial chebyshev_derivative(const ChebyshevPolynomial *c)
+{
+    int n = c->degree;
+
+    if (n == 0)
+        return allocate_chebyshev(0, c->lower, c->upper);
+
+    // two spare zero slots so that b[k + 1] exists for k = n
+    ChebyshevPolynomial d = allocate_chebyshev(n + 1, c->lower, c->upper);
+    double *b = d.coefficients;
+
+    // b_(k-1) = b_(k+1) + 2k a_k, with b_0 halved at the end
+    for (int k = n; k >= 1; k--)
+        b[k - 1] = b[k + 1] + 2.0 * k * c->coefficients[k];
+    b[0] /= 2.0;
+
+    // dt/dx of the map onto [-1, 1]
+    double scale = 2.0 / (c->upper - c->lower);
+    for (int k = 0; k < n; k++)
+        b[k] *= scale;
+
+    d.degree = n - 1;
+
+    return d;
+}
+
+ChebyshevPolynomial chebyshev_truncate(const ChebyshevPolynomial *c, double tolerance)
+{
+    int degree = c->degree;
+    double dropped = 0.0;
+
+    while (degree > 0 && dropped + fabs(c->coefficients[degree]) <= tolerance)
+    {
+        dropped += fabs(c->coefficients[degree]);
+        degree--;
+    }
+
+    ChebyshevPolynomial truncated = allocate_chebyshev(degree, c->lower, c->upper);
+    memcpy(truncated.coefficients, c->coefficients, (degree + 1) * sizeof(double));
+
+    return truncated;
+}
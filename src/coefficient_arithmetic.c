@@ -0,0 +1,312 @@
+// coefficient_arithmetic.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "coefficient_arithmetic.h"
+
+static void multiply_schoolbook(const double *restrict a, size_t a_len, const double *restrict b, size_t b_len,
+                                double *restrict out)
+{
+    memset(out, 0, (a_len + b_len - 1) * sizeof(double));
+
+    for (size_t i = 0; i < a_len; i++)
+    {
+        double ai = a[i];
+        for (size_t j = 0; j < b_len; j++)
+            out[i + j] += ai * b[j];
+    }
+}
+
+// Scratch needed by multiply_karatsuba for operands of length n
+static size_t karatsuba_scratch_length(size_t n)
+{
+    size_t length = 0;
+
+    while (n > KARATSUBA_THRESHOLD)
+    {
+        size_t high = n - n / 2;
+
+        // both half sums and their product, then the levels below
+        length += 2 * high + (2 * high - 1);
+        n = high;
+    }
+
+    return length;
+}
+
+// out[0 .. 2n - 2] = a * b for two operands of length n. The split
+// a = a0 + x^m a1 needs three half-size products:
+//   a0 b0, a1 b1 and (a0 + a1)(b0 + b1) - a0 b0 - a1 b1.
+// Every level takes its temporaries from the front of scratch and hands the rest on,
+// so one allocation serves the whole recursion.
+static void multiply_karatsuba(const double *a, const double *b, size_t n, double *out, double *scratch)
+{
+    if (n <= KARATSUBA_THRESHOLD)
+    {
+        multiply_schoolbook(a, n, b, n, out);
+        return;
+    }
+
+    size_t m = n / 2;
+    size_t high = n - m;
+
+    double *sum_a = scratch;
+    double *sum_b = sum_a + high;
+    double *middle = sum_b + high;
+    double *rest = middle + (2 * high - 1);
+
+    // a0 b0 and a1 b1 go straight to their places in out
+    multiply_karatsuba(a, b, m, out, rest);
+    out[2 * m - 1] = 0.0;
+    multiply_karatsuba(a + m, b + m, high, out + 2 * m, rest);
+
+    for (size_t i = 0; i < high; i++)
+    {
+        sum_a[i] = a[m + i] + (i < m ? a[i] : 0.0);
+        sum_b[i] = b[m + i] + (i < m ? b[i] : 0.0);
+    }
+
+    multiply_karatsuba(sum_a, sum_b, high, middle, rest);
+
+    for (size_t i = 0; i < 2 * m - 1; i++)
+        middle[i] -= out[i];
+
+    for (size_t i = 0; i < 2 * high - 1; i++)
+        middle[i] -= out[2 * m + i];
+
+    for (size_t i = 0; i < 2 * high - 1; i++)
+        out[m + i] += middle[i];
+}
+
+// Karatsuba's half sums a0 + a1 mix coefficients of different sizes, which is where
+// its error turns normwise; see the header
+void coefficients_multiply(const double *a, size_t a_len, const double *b, size_t b_len, double *out)
+{
+    if (a_len < b_len)
+    {
+        const double *swap = a;
+        a = b;
+        b = swap;
+
+        size_t swap_len = a_len;
+        a_len = b_len;
+        b_len = swap_len;
+    }
+
+    if (b_len <= KARATSUBA_THRESHOLD)
+    {
+        multiply_schoolbook(a, a_len, b, b_len, out);
+        return;
+    }
+
+    if (b_len >= FFT_THRESHOLD)
+    {
+        // operands the FFT bands cannot cover span too many orders of magnitude for
+        // Karatsuba's normwise error as well; only the schoolbook product keeps every
+        // coefficient's relative accuracy
+        if (!coefficients_multiply_fft(a, a_len, b, b_len, out))
+            multiply_schoolbook(a, a_len, b, b_len, out);
+        return;
+    }
+
+    // the longer operand is cut into slices as long as the shorter one, so every
+    // product is balanced; the last slice is zero padded
+    double *scratch = malloc((karatsuba_scratch_length(b_len) + 3 * b_len) * sizeof(double));
+    if (!scratch)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    double *slice = scratch;
+    double *product = slice + b_len;
+    double *rest = product + 2 * b_len - 1;
+
+    memset(out, 0, (a_len + b_len - 1) * sizeof(double));
+
+    for (size_t start = 0; start < a_len; start += b_len)
+    {
+        size_t length = (a_len - start < b_len) ? a_len - start : b_len;
+
+        if (length <= KARATSUBA_THRESHOLD)
+        {
+            multiply_schoolbook(a + start, length, b, b_len, product);
+        }
+        else
+        {
+            memcpy(slice, a + start, length * sizeof(double));
+            memset(slice + length, 0, (b_len - length) * sizeof(double));
+
+            multiply_karatsuba(slice, b, b_len, product, rest);
+        }
+
+        for (size_t i = 0; i < length + b_len - 1; i++)
+            out[start + i] += product[i];
+    }
+
+    free(scratch);
+}
+
+// Binary exponent e with |a[i]| < 2^e for every i, or -1 when a coefficient is not
+// an integer below 2^62
+static int integer_bits(const double *a, size_t len)
+{
+    double largest = 0.0;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        if (a[i] != trunc(a[i]) || !(fabs(a[i]) < 0x1p62))
+            return -1;
+
+        largest = fmax(largest, fabs(a[i]));
+    }
+
+    int exponent;
+    frexp(largest, &exponent);
+
+    return exponent;
+}
+
+bool coefficients_multiply_integer(const double *a, size_t a_len, const double *b, size_t b_len, double *out)
+{
+    int a_bits = integer_bits(a, a_len);
+    int b_bits = integer_bits(b, b_len);
+
+    if (a_bits < 0 || b_bits < 0)
+        return false;
+
+    size_t shorter = (a_len < b_len) ? a_len : b_len;
+
+    // each result coefficient sums at most `shorter` products
+    int bits = a_bits + b_bits;
+    while (((size_t)1 << (bits - a_bits - b_bits)) < shorter)
+        bits++;
+
+    // every partial sum of the schoolbook product is an integer below 2^53
+    if (bits <= 53 && shorter < NTT_THRESHOLD)
+    {
+        if (a_len < b_len)
+            multiply_schoolbook(b, b_len, a, a_len, out);
+        else
+            multiply_schoolbook(a, a_len, b, b_len, out);
+        return true;
+    }
+
+    return coefficients_multiply_ntt(a, a_len, b, b_len, bits, out);
+}
+
+// Classic long division; scratch holds a_len values
+static void divide_classic(const double *a, size_t a_len, const double *restrict b, size_t b_len, double *quotient,
+                           double *remainder, double *restrict scratch)
+{
+    size_t k = a_len - b_len + 1;
+    double lead = b[b_len - 1];
+
+    memcpy(scratch, a, a_len * sizeof(double));
+
+    for (size_t shift = k; shift-- > 0;)
+    {
+        double q = scratch[shift + b_len - 1] / lead;
+        quotient[shift] = q;
+
+        for (size_t j = 0; j + 1 < b_len; j++)
+            scratch[shift + j] -= q * b[j];
+    }
+
+    memcpy(remainder, scratch, (b_len - 1) * sizeof(double));
+}
+
+// g[0 .. k - 1] = 1 / f mod x^k by Newton's iteration g <- g (2 - f g), which doubles
+// the number of correct terms per step; scratch holds 4k values
+static void series_inverse(const double *f, size_t f_len, size_t k, double *g, double *scratch)
+{
+    double *error = scratch;
+    double *correction = scratch + 2 * k;
+
+    g[0] = 1.0 / f[0];
+
+    for (size_t done = 1; done < k;)
+    {
+        size_t next = (2 * done < k) ? 2 * done : k;
+        size_t f_used = (f_len < next) ? f_len : next;
+
+        // f g = 1 + x^done e, so only its terms done .. next - 1 matter
+        coefficients_multiply(f, f_used, g, done, error);
+
+        size_t product_len = f_used + done - 1;
+        if (product_len < next)
+            memset(error + product_len, 0, (next - product_len) * sizeof(double));
+
+        // next <= 2 done, so g is only needed modulo x^missing
+        size_t missing = next - done;
+        coefficients_multiply(g, missing, error + done, missing, correction);
+
+        for (size_t i = 0; i < missing; i++)
+            g[done + i] = -correction[i];
+
+        done = next;
+    }
+}
+
+void coefficients_divide(const double *a, size_t a_len, const double *b, size_t b_len, double *quotient,
+                         double *remainder)
+{
+    size_t k = a_len - b_len + 1;
+
+    if (k < NEWTON_DIVISION_THRESHOLD || b_len < NEWTON_DIVISION_THRESHOLD)
+    {
+        double *scratch = malloc(a_len * sizeof(double));
+        if (!scratch)
+        {
+            perror("malloc failed");
+            exit(EXIT_FAILURE);
+        }
+
+        divide_classic(a, a_len, b, b_len, quotient, remainder, scratch);
+
+        free(scratch);
+        return;
+    }
+
+    // with reversed coefficients the quotient is a truncated power series product:
+    // rev(q) = rev(a) / rev(b) mod x^k
+    size_t reversed_len = (b_len < k) ? b_len : k;
+    double *scratch = malloc((reversed_len + 3 * k + 4 * k + a_len) * sizeof(double));
+    if (!scratch)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    double *reversed = scratch;
+    double *inverse = reversed + reversed_len;
+    double *product = inverse + k;
+    double *work = product + 2 * k;
+    double *multiple = work + 4 * k;
+
+    for (size_t i = 0; i < reversed_len; i++)
+        reversed[i] = b[b_len - 1 - i];
+
+    series_inverse(reversed, reversed_len, k, inverse, work);
+
+    // rev(a) mod x^k, built in work, times the inverse
+    for (size_t i = 0; i < k; i++)
+        work[i] = a[a_len - 1 - i];
+
+    coefficients_multiply(work, k, inverse, k, product);
+
+    for (size_t i = 0; i < k; i++)
+        quotient[i] = product[k - 1 - i];
+
+    // the remainder is what the quotient leaves of a below x^(b_len - 1), so both
+    // factors are only needed to that order
+    size_t low = b_len - 1;
+    coefficients_multiply(quotient, (k < low) ? k : low, b, low, multiple);
+
+    for (size_t i = 0; i + 1 < b_len; i++)
+        remainder[i] = a[i] - multiple[i];
+
+    free(scratch);
+}
@@ -0,0 +1,367 @@
+// coefficient_fft.c
+#include <stdio.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "coefficient_arithmetic.h"
+
+// Binary orders of magnitude spanned by one band of coefficients
+#define FFT_BAND_BITS 20
+
+// Bands per operand; wider coefficient ranges use the schoolbook product instead
+#define FFT_MAX_BANDS 4
+
+// pi to double precision; M_PI is not standard C
+#define FFT_PI 3.14159265358979323846
+
+// Complex value as a plain pair, since MSVC has no C99 complex arithmetic
+typedef struct
+{
+    double re;
+    double im;
+} Complex;
+
+// Index range [first, last] holding the nonzero entries of a band; empty when first > last
+typedef struct
+{
+    size_t first;
+    size_t last;
+} Support;
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+// twiddles[k] = exp(-2 pi i k / n) for k < n / 2, each taken from cos and sin
+// directly so the table carries no accumulated error
+static Complex *create_twiddles(size_t n)
+{
+    Complex *twiddles = allocate_or_exit((n / 2) * sizeof(Complex));
+
+    for (size_t k = 0; k < n / 2; k++)
+    {
+        double angle = -2.0 * FFT_PI * (double)k / (double)n;
+        twiddles[k] = (Complex){cos(angle), sin(angle)};
+    }
+
+    return twiddles;
+}
+
+static inline Complex complex_add(Complex x, Complex y)
+{
+    return (Complex){x.re + y.re, x.im + y.im};
+}
+
+static inline Complex complex_subtract(Complex x, Complex y)
+{
+    return (Complex){x.re - y.re, x.im - y.im};
+}
+
+static inline Complex complex_multiply(Complex x, Complex y)
+{
+    return (Complex){x.re * y.re - x.im * y.im, x.re * y.im + x.im * y.re};
+}
+
+// In-place iterative radix-2 transform; inverse transforms are left unscaled
+static void fft(Complex *z, size_t n, const Complex *twiddles, int inverse)
+{
+    for (size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            Complex swap = z[i];
+            z[i] = z[j];
+            z[j] = swap;
+        }
+    }
+
+    for (size_t length = 2; length <= n; length <<= 1)
+    {
+        size_t stride = n / length;
+
+        for (size_t start = 0; start < n; start += length)
+        {
+            for (size_t k = 0; k < length / 2; k++)
+            {
+                Complex w = twiddles[k * stride];
+                if (inverse)
+                    w.im = -w.im;
+
+                Complex even = z[start + k];
+                Complex odd = complex_multiply(z[start + k + length / 2], w);
+
+                z[start + k] = complex_add(even, odd);
+                z[start + k + length / 2] = complex_subtract(even, odd);
+            }
+        }
+    }
+}
+
+// Spectra of two real sequences from one complex transform of x + i y
+static void transform_real_pair(const double *x, const double *y, size_t n,
+                                const Complex *twiddles, Complex *work,
+                                Complex *x_spectrum, Complex *y_spectrum)
+{
+    for (size_t k = 0; k < n; k++)
+        work[k] = (Complex){x[k], y ? y[k] : 0.0};
+
+    fft(work, n, twiddles, 0);
+
+    for (size_t k = 0; k < n; k++)
+    {
+        Complex mirrored = work[(n - k) & (n - 1)];
+        mirrored.im = -mirrored.im;
+
+        Complex sum = complex_add(work[k], mirrored);
+        Complex difference = complex_subtract(work[k], mirrored);
+
+        // sum / 2 and difference / 2i
+        x_spectrum[k] = (Complex){sum.re / 2.0, sum.im / 2.0};
+        if (y_spectrum)
+            y_spectrum[k] = (Complex){difference.im / 2.0, -difference.re / 2.0};
+    }
+}
+
+// Splits a into magnitude bands: each band starts at the largest exponent not yet
+// taken and holds every remaining coefficient within FFT_BAND_BITS binary orders of
+// it. bands[s * n + i] holds a[i] * 2^-top[s] when it falls in band s, so every band
+// peaks just below one, and support[s] records where band s is nonzero. Returns the
+// band count, or 0 when a is zero or needs more than FFT_MAX_BANDS.
+static int split_into_bands(const double *a, size_t len, size_t n, double *bands, Support *support, int *top)
+{
+    int *exponent = allocate_or_exit(len * sizeof(int));
+    int *band_of = allocate_or_exit(len * sizeof(int));
+
+    for (size_t i = 0; i < len; i++)
+    {
+        frexp(a[i], &exponent[i]);
+        band_of[i] = -1;
+    }
+
+    int band_count = 0;
+
+    for (;;)
+    {
+        bool found = false;
+        int largest = 0;
+
+        for (size_t i = 0; i < len; i++)
+            if (a[i] != 0.0 && band_of[i] < 0 && (!found || exponent[i] > largest))
+            {
+                largest = exponent[i];
+                found = true;
+            }
+
+        if (!found)
+            break;
+
+        if (band_count == FFT_MAX_BANDS)
+        {
+            band_count = 0;
+            break;
+        }
+
+        top[band_count] = largest;
+        support[band_count] = (Support){.first = len, .last = 0};
+
+        for (size_t i = 0; i < len; i++)
+            if (a[i] != 0.0 && band_of[i] < 0 && exponent[i] > largest - FFT_BAND_BITS)
+            {
+                band_of[i] = band_count;
+
+                if (i < support[band_count].first)
+                    support[band_count].first = i;
+                support[band_count].last = i;
+            }
+
+        band_count++;
+    }
+
+    if (band_count > 0)
+    {
+        memset(bands, 0, (size_t)band_count * n * sizeof(double));
+
+        for (size_t i = 0; i < len; i++)
+            if (band_of[i] >= 0)
+                bands[band_of[i] * n + i] = ldexp(a[i], -top[band_of[i]]);
+    }
+
+    free(exponent);
+    free(band_of);
+
+    return band_count;
+}
+
+// The rounding error of an FFT convolution scales with the largest inputs, which
+// swamps small coefficients. Each operand is therefore split into magnitude bands;
+// bands are scaled by powers of two to a common magnitude, so transforms that share
+// one complex FFT do not leak noise into each other. Band products of equal rank
+// s + t share one inverse transform at the scale of the largest of them, and the
+// partial products are summed from the highest rank down, each only where its
+// bands overlap so its rounding noise never lands on coefficients built from
+// smaller bands alone.
+bool coefficients_multiply_fft(const double *a, size_t a_len, const double *b, size_t b_len, double *out)
+{
+    size_t out_len = a_len + b_len - 1;
+
+    size_t n = 1;
+    while (n < out_len)
+        n <<= 1;
+
+    double *a_bands = allocate_or_exit(FFT_MAX_BANDS * n * sizeof(double));
+    double *b_bands = allocate_or_exit(FFT_MAX_BANDS * n * sizeof(double));
+
+    Support a_support[FFT_MAX_BANDS];
+    Support b_support[FFT_MAX_BANDS];
+
+    int a_top[FFT_MAX_BANDS];
+    int b_top[FFT_MAX_BANDS];
+
+    int a_count = split_into_bands(a, a_len, n, a_bands, a_support, a_top);
+    int b_count = split_into_bands(b, b_len, n, b_bands, b_support, b_top);
+
+    if (a_count == 0 || b_count == 0)
+    {
+        free(a_bands);
+        free(b_bands);
+        return false;
+    }
+
+    int rank_count = a_count + b_count - 1;
+
+    // where each rank is nonzero, and the binary exponent of its largest band product
+    Support rank_support[2 * FFT_MAX_BANDS - 1];
+    int rank_top[2 * FFT_MAX_BANDS - 1];
+
+    for (int r = 0; r < rank_count; r++)
+    {
+        rank_support[r] = (Support){.first = out_len, .last = 0};
+        rank_top[r] = INT_MIN;
+    }
+
+    for (int s = 0; s < a_count; s++)
+        for (int t = 0; t < b_count; t++)
+        {
+            Support *range = &rank_support[s + t];
+            size_t first = a_support[s].first + b_support[t].first;
+            size_t last = a_support[s].last + b_support[t].last;
+
+            if (first < range->first)
+                range->first = first;
+            if (last > range->last)
+                range->last = last;
+            if (a_top[s] + b_top[t] > rank_top[s + t])
+                rank_top[s + t] = a_top[s] + b_top[t];
+        }
+
+    Complex *twiddles = create_twiddles(n);
+    Complex *work = allocate_or_exit(n * sizeof(Complex));
+    Complex *a_spectra = allocate_or_exit((size_t)a_count * n * sizeof(Complex));
+    Complex *b_spectra = allocate_or_exit((size_t)b_count * n * sizeof(Complex));
+    Complex *rank_spectra = calloc((size_t)rank_count * n, sizeof(Complex));
+
+    if (!rank_spectra)
+    {
+        perror("calloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    // bands of a and b transformed two at a time
+    int total = a_count + b_count;
+    for (int s = 0; s < total; s += 2)
+    {
+        const double *x = (s < a_count) ? a_bands + s * n : b_bands + (s - a_count) * n;
+        Complex *x_spectrum = (s < a_count) ? a_spectra + s * n : b_spectra + (s - a_count) * n;
+
+        const double *y = NULL;
+        Complex *y_spectrum = NULL;
+
+        if (s + 1 < total)
+        {
+            y = (s + 1 < a_count) ? a_bands + (s + 1) * n : b_bands + (s + 1 - a_count) * n;
+            y_spectrum = (s + 1 < a_count) ? a_spectra + (s + 1) * n : b_spectra + (s + 1 - a_count) * n;
+        }
+
+        transform_real_pair(x, y, n, twiddles, work, x_spectrum, y_spectrum);
+    }
+
+    for (int s = 0; s < a_count; s++)
+        for (int t = 0; t < b_count; t++)
+        {
+            // exact power of two; products far below the rank scale may flush to zero
+            double scale = ldexp(1.0, a_top[s] + b_top[t] - rank_top[s + t]);
+
+            Complex *rank = rank_spectra + (size_t)(s + t) * n;
+            const Complex *as = a_spectra + (size_t)s * n;
+            const Complex *bt = b_spectra + (size_t)t * n;
+
+            for (size_t k = 0; k < n; k++)
+            {
+                Complex product = complex_multiply(as[k], bt[k]);
+
+                rank[k].re += scale * product.re;
+                rank[k].im += scale * product.im;
+            }
+        }
+
+    memset(out, 0, out_len * sizeof(double));
+
+    // products are real, so two ranks share one inverse transform
+    for (int r = rank_count - 1; r >= 0; r -= 2)
+    {
+        const Complex *first = rank_spectra + (size_t)r * n;
+        const Complex *second = (r >= 1) ? rank_spectra + (size_t)(r - 1) * n : NULL;
+
+        for (size_t k = 0; k < n; k++)
+        {
+            // first + i second
+            work[k] = first[k];
+
+            if (second)
+            {
+                work[k].re -= second[k].im;
+                work[k].im += second[k].re;
+            }
+        }
+
+        fft(work, n, twiddles, 1);
+
+        // undoes the band scaling and the length of the unscaled inverse transform
+        double first_scale = ldexp(1.0 / n, rank_top[r]);
+
+        for (size_t i = rank_support[r].first; i <= rank_support[r].last; i++)
+            out[i] += first_scale * work[i].re;
+
+        if (second)
+        {
+            double second_scale = ldexp(1.0 / n, rank_top[r - 1]);
+
+            for (size_t i = rank_support[r - 1].first; i <= rank_support[r - 1].last; i++)
+                out[i] += second_scale * work[i].im;
+        }
+    }
+
+    free(twiddles);
+    free(work);
+    free(a_spectra);
+    free(b_spectra);
+    free(rank_spectra);
+    free(a_bands);
+    free(b_bands);
+
+    return true;
+}
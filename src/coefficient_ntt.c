@@ -0,0 +1,266 @@
+// coefficient_ntt.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "coefficient_arithmetic.h"
+#include "uint128.h"
+
+// Primes c 2^40 + 1 just below 2^62 with a primitive root each; their fields hold
+// roots of unity for every transform length up to 2^40
+#define NTT_PRIME_COUNT 2
+
+static const uint64_t ntt_primes[NTT_PRIME_COUNT] = {4611615649683210241ULL, 4611613450659954689ULL};
+static const uint64_t ntt_generators[NTT_PRIME_COUNT] = {11, 3};
+
+// Montgomery arithmetic modulo p with R = 2^64. Values stay in [0, p), and p < 2^62
+// keeps every intermediate below 2^128. The corrections are masks rather than
+// branches, which would mispredict on every other butterfly.
+typedef struct
+{
+    uint64_t p;
+    uint64_t p_negated_inverse; // -p^-1 mod 2^64
+    uint64_t r_squared;         // R^2 mod p
+} Modulus;
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static Modulus create_modulus(uint64_t p)
+{
+    Modulus m = {.p = p};
+
+    // Newton iteration for p^-1 mod 2^64, doubling the correct bits each step
+    uint64_t inverse = p;
+    for (int i = 0; i < 6; i++)
+        inverse *= 2 - p * inverse;
+
+    m.p_negated_inverse = -inverse;
+
+    // 2^64 mod p = (2^64 - p) mod p
+    uint64_t r = (0 - p) % p;
+    uint128_divide(uint128_multiply(r, r), p, &m.r_squared);
+
+    return m;
+}
+
+// t R^-1 mod p for t < p R; t + q p then has a zero low word, and its high word
+// is below 2p < 2^63
+static inline uint64_t reduce(const Modulus *m, Uint128 t)
+{
+    uint64_t q = t.low * m->p_negated_inverse;
+    uint64_t r = uint128_add(t, uint128_multiply(q, m->p)).high;
+    return r - (m->p & -(uint64_t)(r >= m->p));
+}
+
+static inline uint64_t multiply_mod(const Modulus *m, uint64_t a, uint64_t b)
+{
+    return reduce(m, uint128_multiply(a, b));
+}
+
+static inline uint64_t add_mod(const Modulus *m, uint64_t a, uint64_t b)
+{
+    uint64_t sum = a + b;
+    return sum - (m->p & -(uint64_t)(sum >= m->p));
+}
+
+static inline uint64_t subtract_mod(const Modulus *m, uint64_t a, uint64_t b)
+{
+    return a - b + (m->p & -(uint64_t)(a < b));
+}
+
+static uint64_t to_montgomery(const Modulus *m, uint64_t a)
+{
+    return multiply_mod(m, a, m->r_squared);
+}
+
+static uint64_t from_montgomery(const Modulus *m, uint64_t a)
+{
+    return reduce(m, (Uint128){.low = a});
+}
+
+// base^exponent for base in Montgomery form
+static uint64_t power_mod(const Modulus *m, uint64_t base, uint64_t exponent)
+{
+    uint64_t result = to_montgomery(m, 1);
+
+    for (; exponent; exponent >>= 1)
+    {
+        if (exponent & 1)
+            result = multiply_mod(m, result, base);
+        base = multiply_mod(m, base, base);
+    }
+
+    return result;
+}
+
+// In-place iterative radix-2 transform in Montgomery form; roots[k] = w^k for
+// k < n / 2 with w a primitive n-th root of unity (its inverse for the inverse
+// transform, which is left unscaled)
+static void ntt(uint64_t *z, size_t n, const uint64_t *roots, const Modulus *m)
+{
+    for (size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            uint64_t swap = z[i];
+            z[i] = z[j];
+            z[j] = swap;
+        }
+    }
+
+    for (size_t length = 2; length <= n; length <<= 1)
+    {
+        size_t stride = n / length;
+
+        for (size_t start = 0; start < n; start += length)
+        {
+            for (size_t k = 0; k < length / 2; k++)
+            {
+                uint64_t even = z[start + k];
+                uint64_t odd = multiply_mod(m, z[start + k + length / 2], roots[k * stride]);
+
+                z[start + k] = add_mod(m, even, odd);
+                z[start + k + length / 2] = subtract_mod(m, even, odd);
+            }
+        }
+    }
+}
+
+static void fill_roots(uint64_t *roots, size_t n, uint64_t root, const Modulus *m)
+{
+    roots[0] = to_montgomery(m, 1);
+    for (size_t k = 1; k < n / 2; k++)
+        roots[k] = multiply_mod(m, roots[k - 1], root);
+}
+
+// a residue in Montgomery form for each integer coefficient
+static void load_residues(const double *a, size_t len, size_t n, const Modulus *m, uint64_t *residues)
+{
+    int64_t p = (int64_t)m->p;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        int64_t value = (int64_t)a[i] % p;
+        if (value < 0)
+            value += p;
+
+        residues[i] = to_montgomery(m, (uint64_t)value);
+    }
+
+    for (size_t i = len; i < n; i++)
+        residues[i] = 0;
+}
+
+// Cyclic product of a and b modulo one prime, in plain (not Montgomery) form
+static void convolve_modulo(const double *a, size_t a_len, const double *b, size_t b_len, size_t n,
+                            uint64_t prime, uint64_t generator, uint64_t *product)
+{
+    Modulus m = create_modulus(prime);
+
+    uint64_t *other = allocate_or_exit(n * sizeof(uint64_t));
+    uint64_t *roots = allocate_or_exit((n / 2 + 1) * sizeof(uint64_t));
+
+    load_residues(a, a_len, n, &m, product);
+    load_residues(b, b_len, n, &m, other);
+
+    uint64_t root = power_mod(&m, to_montgomery(&m, generator), (prime - 1) / n);
+
+    fill_roots(roots, n, root, &m);
+    ntt(product, n, roots, &m);
+    ntt(other, n, roots, &m);
+
+    for (size_t k = 0; k < n; k++)
+        product[k] = multiply_mod(&m, product[k], other[k]);
+
+    // w^-1 = w^(n - 1)
+    fill_roots(roots, n, power_mod(&m, root, n - 1), &m);
+    ntt(product, n, roots, &m);
+
+    // n^-1 = n^(p - 2)
+    uint64_t scale = power_mod(&m, to_montgomery(&m, n % prime), prime - 2);
+
+    for (size_t k = 0; k < n; k++)
+        product[k] = from_montgomery(&m, multiply_mod(&m, product[k], scale));
+
+    free(other);
+    free(roots);
+}
+
+bool coefficients_multiply_ntt(const double *a, size_t a_len, const double *b, size_t b_len, int bits, double *out)
+{
+    // the signed result must fit in half the product of the primes used
+    int prime_count = (bits <= 61) ? 1 : 2;
+    if (bits > 123)
+        return false;
+
+    size_t out_len = a_len + b_len - 1;
+
+    size_t n = 1;
+    while (n < out_len)
+        n <<= 1;
+
+    uint64_t *residues[NTT_PRIME_COUNT];
+
+    for (int j = 0; j < prime_count; j++)
+    {
+        residues[j] = allocate_or_exit(n * sizeof(uint64_t));
+        convolve_modulo(a, a_len, b, b_len, n, ntt_primes[j], ntt_generators[j], residues[j]);
+    }
+
+    if (prime_count == 1)
+    {
+        uint64_t p = ntt_primes[0];
+
+        for (size_t i = 0; i < out_len; i++)
+        {
+            uint64_t r = residues[0][i];
+            out[i] = (r > p / 2) ? -(double)(p - r) : (double)r;
+        }
+    }
+    else
+    {
+        // Garner: x = r0 + p0 ((r1 - r0) p0^-1 mod p1), then centred around zero
+        uint64_t p0 = ntt_primes[0];
+        uint64_t p1 = ntt_primes[1];
+
+        Modulus m1 = create_modulus(p1);
+        uint64_t p0_inverse = power_mod(&m1, to_montgomery(&m1, p0 % p1), p1 - 2);
+
+        Uint128 modulus = uint128_multiply(p0, p1);
+        Uint128 half = {.low = (modulus.low >> 1) | (modulus.high << 63), .high = modulus.high >> 1};
+
+        for (size_t i = 0; i < out_len; i++)
+        {
+            uint64_t r0 = residues[0][i];
+            uint64_t r1 = residues[1][i];
+
+            uint64_t difference = subtract_mod(&m1, r1, r0 % p1);
+            uint64_t digit = from_montgomery(&m1, multiply_mod(&m1, to_montgomery(&m1, difference), p0_inverse));
+
+            Uint128 x = uint128_add(uint128_multiply(p0, digit), (Uint128){.low = r0});
+
+            // the conversion of a 128 bit integer rounds correctly
+            out[i] = uint128_less(half, x) ? -uint128_to_double(uint128_subtract(modulus, x)) : uint128_to_double(x);
+        }
+    }
+
+    for (int j = 0; j < prime_count; j++)
+        free(residues[j]);
+
+    return true;
+}
@@ -216,16 +216,6 @@ void help_menu()
     delwin(help_win);
 }
 
-double compute_polynomial_value_wrapper(double x)
-{
-    if (selected_polynomial == 1 && polynomial1_defined)
-        return polynomial_evaluate(&p1, x);
-    else if (selected_polynomial == 2 && polynomial2_defined)
-        return polynomial_evaluate(&p2, x);
-    else
-        return 0.0;
-}
-
 void display_polynomial(WINDOW *win, int start_y, int start_x, const Polynomial *p)
 {
     mvwprintw(win, start_y, start_x, "Polynomial formula: ");
@@ -854,11 +844,11 @@ void draw_polynomial_plot_menu()
     mvwprintw(plot_win, 12, 2, "Plotting...");
     wrefresh(plot_win);
 
-    plot_function(
+    plot_polynomial(
         image,
         width,
         height,
-        compute_polynomial_value_wrapper,
+        selected_polynomial == 1 ? &p1 : &p2,
         -x, x,
         -y, y,
         thickness);
@@ -0,0 +1,375 @@
+// mod_polynomial.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "mod_polynomial.h"
+#include "uint128.h"
+
+const uint64_t mod_polynomial_primes[MOD_POLYNOMIAL_PRIME_COUNT] = {
+    4611686018427387847ULL, 4611686018427387817ULL, 4611686018427387787ULL, 4611686018427387761ULL};
+
+// Residue arithmetic for p < 2^62. The corrections are masks rather than branches,
+// so the add and subtract loops vectorize. Products with a factor w fixed across a
+// loop (a row of a product, a quotient term, the point of Horner's rule) use Shoup's
+// precomputed quotient floor(w 2^64 / p): two multiplications and no division.
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static inline uint64_t add_mod(uint64_t a, uint64_t b, uint64_t p)
+{
+    uint64_t sum = a + b;
+    return sum - (p & -(uint64_t)(sum >= p));
+}
+
+static inline uint64_t subtract_mod(uint64_t a, uint64_t b, uint64_t p)
+{
+    return a - b + (p & -(uint64_t)(a < b));
+}
+
+static inline uint64_t multiply_mod(uint64_t a, uint64_t b, uint64_t p)
+{
+    uint64_t rest;
+    uint128_divide(uint128_multiply(a, b), p, &rest);
+    return rest;
+}
+
+static inline uint64_t shoup_quotient(uint64_t w, uint64_t p)
+{
+    return uint128_divide((Uint128){.low = 0, .high = w}, p, NULL);
+}
+
+// w b mod p given w_quotient = shoup_quotient(w, p)
+static inline uint64_t multiply_shoup(uint64_t w, uint64_t w_quotient, uint64_t b, uint64_t p)
+{
+    uint64_t q = uint128_multiply_high(w_quotient, b);
+    uint64_t r = w * b - q * p;
+    return r - (p & -(uint64_t)(r >= p));
+}
+
+static uint64_t power_mod(uint64_t base, uint64_t exponent, uint64_t p)
+{
+    uint64_t result = 1 % p;
+
+    for (; exponent; exponent >>= 1)
+    {
+        if (exponent & 1)
+            result = multiply_mod(result, base, p);
+        base = multiply_mod(base, base, p);
+    }
+
+    return result;
+}
+
+uint64_t mod_from_double(double x, uint64_t modulus)
+{
+    // polynomial_is_integer accepts coefficients within 1e-9 of an integer, so
+    // 2.9999999999 must reduce as 3, not truncate to 2
+    x = round(x);
+    double magnitude = fabs(x);
+    uint64_t residue;
+
+    if (magnitude < 9223372036854775808.0)
+    {
+        residue = (uint64_t)magnitude % modulus;
+    }
+    else
+    {
+        // magnitude = m 2^(exponent - 53) with m a 53-bit integer
+        int exponent;
+        double m = ldexp(frexp(magnitude, &exponent), 53);
+
+        residue = multiply_mod((uint64_t)m % modulus, power_mod(2, exponent - 53, modulus), modulus);
+    }
+
+    return (x < 0) ? subtract_mod(0, residue, modulus) : residue;
+}
+
+uint64_t mod_multiply(uint64_t a, uint64_t b, uint64_t modulus)
+{
+    return multiply_mod(a % modulus, b % modulus, modulus);
+}
+
+uint64_t mod_inverse(uint64_t a, uint64_t modulus)
+{
+    // extended Euclid, keeping only the coefficient of a; with modulus < 2^62 every
+    // value fits a signed word. A few dozen word divisions against the hundred or so
+    // wide ones of Fermat's a^(p - 2).
+    int64_t r0 = (int64_t)modulus, r1 = (int64_t)(a % modulus);
+    int64_t t0 = 0, t1 = 1;
+
+    while (r1 != 0)
+    {
+        int64_t q = r0 / r1;
+
+        int64_t r = r0 - q * r1;
+        r0 = r1;
+        r1 = r;
+
+        int64_t t = t0 - q * t1;
+        t0 = t1;
+        t1 = t;
+    }
+
+    return (t0 < 0) ? (uint64_t)(t0 + (int64_t)modulus) : (uint64_t)t0;
+}
+
+// drops zero leading coefficients, keeping the allocation
+static void trim_degree(ModPolynomial *p)
+{
+    while (p->degree > 0 && p->coefficients[p->degree] == 0)
+        p->degree--;
+}
+
+// room for degree + 1 coefficients, all zero
+static ModPolynomial create_zero_mod_polynomial(int degree, uint64_t modulus)
+{
+    ModPolynomial p = {.modulus = modulus, .degree = degree};
+    p.coefficients = allocate_or_exit((degree + 1) * sizeof(uint64_t));
+    memset(p.coefficients, 0, (degree + 1) * sizeof(uint64_t));
+
+    return p;
+}
+
+ModPolynomial create_mod_polynomial(const uint64_t *coefficients, int degree, uint64_t modulus)
+{
+    ModPolynomial p = create_zero_mod_polynomial(degree, modulus);
+
+    for (int i = 0; i <= degree; i++)
+        p.coefficients[i] = coefficients[i] % modulus;
+
+    trim_degree(&p);
+    return p;
+}
+
+ModPolynomial mod_polynomial_from_polynomial(const Polynomial *p, uint64_t modulus)
+{
+    ModPolynomial result = create_zero_mod_polynomial(p->degree, modulus);
+
+    for (int i = 0; i <= p->degree; i++)
+        result.coefficients[i] = mod_from_double(p->coefficients[i], modulus);
+
+    trim_degree(&result);
+    return result;
+}
+
+ModPolynomial copy_mod_polynomial(const ModPolynomial *p)
+{
+    ModPolynomial result = create_zero_mod_polynomial(p->degree, p->modulus);
+    memcpy(result.coefficients, p->coefficients, (p->degree + 1) * sizeof(uint64_t));
+
+    return result;
+}
+
+void free_mod_polynomial(ModPolynomial *p)
+{
+    free(p->coefficients);
+    p->coefficients = NULL;
+    p->degree = 0;
+}
+
+ModPolynomial mod_polynomial_add(const ModPolynomial *p1, const ModPolynomial *p2)
+{
+    const ModPolynomial *longer = (p1->degree >= p2->degree) ? p1 : p2;
+    const ModPolynomial *shorter = (p1->degree >= p2->degree) ? p2 : p1;
+
+    ModPolynomial result = copy_mod_polynomial(longer);
+    uint64_t p = result.modulus;
+
+    for (int i = 0; i <= shorter->degree; i++)
+        result.coefficients[i] = add_mod(result.coefficients[i], shorter->coefficients[i], p);
+
+    trim_degree(&result);
+    return result;
+}
+
+ModPolynomial mod_polynomial_subtract(const ModPolynomial *p1, const ModPolynomial *p2)
+{
+    int degree = (p1->degree > p2->degree) ? p1->degree : p2->degree;
+
+    ModPolynomial result = create_zero_mod_polynomial(degree, p1->modulus);
+    uint64_t p = result.modulus;
+
+    memcpy(result.coefficients, p1->coefficients, (p1->degree + 1) * sizeof(uint64_t));
+
+    for (int i = 0; i <= p2->degree; i++)
+        result.coefficients[i] = subtract_mod(result.coefficients[i], p2->coefficients[i], p);
+
+    trim_degree(&result);
+    return result;
+}
+
+ModPolynomial mod_polynomial_multiply(const ModPolynomial *p1, const ModPolynomial *p2)
+{
+    ModPolynomial result = create_zero_mod_polynomial(p1->degree + p2->degree, p1->modulus);
+    uint64_t p = result.modulus;
+
+    for (int i = 0; i <= p1->degree; i++)
+    {
+        uint64_t w = p1->coefficients[i];
+        if (w == 0)
+            continue;
+
+        uint64_t w_quotient = shoup_quotient(w, p);
+        uint64_t *row = result.coefficients + i;
+
+        for (int j = 0; j <= p2->degree; j++)
+            row[j] = add_mod(row[j], multiply_shoup(w, w_quotient, p2->coefficients[j], p), p);
+    }
+
+    trim_degree(&result);
+    return result;
+}
+
+ModPolynomial mod_polynomial_derivative(const ModPolynomial *p)
+{
+    if (p->degree == 0)
+        return create_zero_mod_polynomial(0, p->modulus);
+
+    ModPolynomial result = create_zero_mod_polynomial(p->degree - 1, p->modulus);
+
+    for (int i = 1; i <= p->degree; i++)
+        result.coefficients[i - 1] = multiply_mod(p->coefficients[i], (uint64_t)i % p->modulus, p->modulus);
+
+    trim_degree(&result);
+    return result;
+}
+
+// a mod b in place for a nonzero leading b, writing the quotient terms to quotient
+// when it is not NULL. Returns the remainder's degree, -1 for zero.
+static int remainder_in_place(uint64_t *a, int a_degree, const uint64_t *b, int b_degree, uint64_t p,
+                              uint64_t *quotient)
+{
+    uint64_t lead_inverse = mod_inverse(b[b_degree], p);
+
+    for (int shift = a_degree - b_degree; shift >= 0; shift--)
+    {
+        uint64_t q = multiply_mod(a[shift + b_degree], lead_inverse, p);
+
+        if (quotient)
+            quotient[shift] = q;
+
+        if (q == 0)
+            continue;
+
+        uint64_t q_quotient = shoup_quotient(q, p);
+
+        for (int j = 0; j < b_degree; j++)
+            a[shift + j] = subtract_mod(a[shift + j], multiply_shoup(q, q_quotient, b[j], p), p);
+
+        a[shift + b_degree] = 0;
+    }
+
+    int degree = (a_degree < b_degree) ? a_degree : b_degree - 1;
+    while (degree >= 0 && a[degree] == 0)
+        degree--;
+
+    return degree;
+}
+
+ModPolynomial mod_polynomial_divide(const ModPolynomial *p1, const ModPolynomial *p2, ModPolynomial *rest)
+{
+    uint64_t p = p1->modulus;
+
+    if (p1->degree < p2->degree)
+    {
+        *rest = copy_mod_polynomial(p1);
+        return create_zero_mod_polynomial(0, p);
+    }
+
+    ModPolynomial quotient = create_zero_mod_polynomial(p1->degree - p2->degree, p);
+    ModPolynomial remainder = copy_mod_polynomial(p1);
+
+    int degree = remainder_in_place(remainder.coefficients, remainder.degree, p2->coefficients, p2->degree, p,
+                                    quotient.coefficients);
+
+    remainder.degree = (degree < 0) ? 0 : degree;
+
+    trim_degree(&quotient);
+
+    *rest = remainder;
+    return quotient;
+}
+
+ModPolynomial mod_polynomial_gcd(const ModPolynomial *p1, const ModPolynomial *p2)
+{
+    uint64_t p = p1->modulus;
+
+    int u_degree = mod_polynomial_is_zero(p1) ? -1 : p1->degree;
+    int v_degree = mod_polynomial_is_zero(p2) ? -1 : p2->degree;
+
+    if (u_degree < 0 && v_degree < 0)
+        return create_zero_mod_polynomial(0, p);
+
+    // Euclid's algorithm on two buffers that trade places after each remainder
+    int size = ((u_degree > v_degree) ? u_degree : v_degree) + 1;
+    uint64_t *u = allocate_or_exit(size * sizeof(uint64_t));
+    uint64_t *v = allocate_or_exit(size * sizeof(uint64_t));
+
+    const ModPolynomial *high = (u_degree >= v_degree) ? p1 : p2;
+    const ModPolynomial *low = (u_degree >= v_degree) ? p2 : p1;
+
+    if (u_degree < v_degree)
+    {
+        int swap = u_degree;
+        u_degree = v_degree;
+        v_degree = swap;
+    }
+
+    memcpy(u, high->coefficients, (u_degree + 1) * sizeof(uint64_t));
+    if (v_degree >= 0)
+        memcpy(v, low->coefficients, (v_degree + 1) * sizeof(uint64_t));
+
+    while (v_degree >= 0)
+    {
+        int r_degree = remainder_in_place(u, u_degree, v, v_degree, p, NULL);
+
+        uint64_t *swap = u;
+        u = v;
+        v = swap;
+
+        u_degree = v_degree;
+        v_degree = r_degree;
+    }
+
+    ModPolynomial result = create_mod_polynomial(u, u_degree, p);
+
+    uint64_t lead_inverse = mod_inverse(result.coefficients[result.degree], p);
+    for (int i = 0; i <= result.degree; i++)
+        result.coefficients[i] = multiply_mod(result.coefficients[i], lead_inverse, p);
+
+    free(u);
+    free(v);
+
+    return result;
+}
+
+bool mod_polynomial_is_zero(const ModPolynomial *p)
+{
+    return p->degree == 0 && p->coefficients[0] == 0;
+}
+
+uint64_t mod_polynomial_evaluate(const ModPolynomial *p, uint64_t x)
+{
+    uint64_t modulus = p->modulus;
+
+    x %= modulus;
+    uint64_t x_quotient = shoup_quotient(x, modulus);
+
+    uint64_t value = p->coefficients[p->degree];
+
+    for (int i = p->degree - 1; i >= 0; i--)
+        value = add_mod(multiply_shoup(x, x_quotient, value, modulus), p->coefficients[i], modulus);
+
+    return value;
+}
@@ -1,4 +1,5 @@
 #include "plot.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
@@ -71,11 +72,9 @@ static void draw_thick_line(unsigned char *img, int w, int h,
     }
 }
 
-void plot_function(unsigned char *image, int width, int height,
-                   Function f,
-                   double xmin, double xmax,
-                   double ymin, double ymax,
-                   int thickness)
+static void draw_axes(unsigned char *image, int width, int height,
+                      double xmin, double xmax,
+                      double ymin, double ymax)
 {
     // Clear background (white)
     memset(image, 255, width * height * 3);
@@ -95,16 +94,43 @@ void plot_function(unsigned char *image, int width, int height,
         for (int x = 0; x < width; x++)
             set_pixel(image, width, height, x, y0, 0, 0, 0);
     }
+}
+
+// Distance of y from the bottom edge in pixels, before truncation to a row
+static double scaled_row(double y, double ymin, double ymax, int height)
+{
+    return (y - ymin) / (ymax - ymin) * height;
+}
+
+// True when every value, moved by up to error, still truncates to the same row
+static bool rows_are_certain(const double *ys, int count, double error,
+                             double ymin, double ymax, int height)
+{
+    for (int i = 0; i < count; i++)
+    {
+        double low = trunc(scaled_row(ys[i] - error, ymin, ymax, height));
+        double high = trunc(scaled_row(ys[i] + error, ymin, ymax, height));
+
+        if (low != high)
+            return false;
+    }
+
+    return true;
+}
 
-    // Plot function with connected values
+// Connects the samples ys[x] taken at every pixel column
+static void draw_samples(unsigned char *image, int width, int height,
+                         const double *ys,
+                         double ymin, double ymax,
+                         int thickness)
+{
     int prev_x = 0;
     int prev_y = 0;
     int has_prev = 0;
 
     for (int x = 0; x < width; x++)
     {
-        double fx = xmin + (double)x / width * (xmax - xmin);
-        double fy = f(fx);
+        double fy = ys[x];
 
         if (isnan(fy) || isinf(fy))
         {
@@ -112,7 +138,7 @@ void plot_function(unsigned char *image, int width, int height,
             continue;
         }
 
-        int y = height - (int)((fy - ymin) / (ymax - ymin) * height);
+        int y = height - (int)scaled_row(fy, ymin, ymax, height);
 
         if (has_prev)
         {
@@ -129,3 +155,93 @@ void plot_function(unsigned char *image, int width, int height,
         has_prev = 1;
     }
 }
+
+static double *allocate_samples(int width)
+{
+    double *samples = malloc(width * sizeof(double));
+    if (!samples)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return samples;
+}
+
+// Pixel columns covered by one interval enclosure in plot_polynomial
+#define PLOT_BLOCK_COLUMNS 32
+
+// True when p provably stays above ymax or below ymin on [x0, x1]
+static bool block_is_off_screen(const Polynomial *p, double x0, double x1, double ymin, double ymax)
+{
+    Interval columns = create_interval(extended_value_finite(x0), extended_value_finite(x1), true, true);
+    Interval enclosure = polynomial_evaluate_interval(p, columns);
+
+    if (enclosure.lower_bound.type != VALUE_FINITE || enclosure.upper_bound.type != VALUE_FINITE)
+        return false;
+
+    return enclosure.lower_bound.value > ymax || enclosure.upper_bound.value < ymin;
+}
+
+void plot_function(unsigned char *image, int width, int height,
+                   Function f,
+                   double xmin, double xmax,
+                   double ymin, double ymax,
+                   int thickness)
+{
+    draw_axes(image, width, height, xmin, xmax, ymin, ymax);
+
+    double *ys = allocate_samples(width);
+
+    for (int x = 0; x < width; x++)
+        ys[x] = f(xmin + (double)x / width * (xmax - xmin));
+
+    draw_samples(image, width, height, ys, ymin, ymax, thickness);
+
+    free(ys);
+}
+
+void plot_polynomial(unsigned char *image, int width, int height,
+                     const Polynomial *p,
+                     double xmin, double xmax,
+                     double ymin, double ymax,
+                     int thickness)
+{
+    draw_axes(image, width, height, xmin, xmax, ymin, ymax);
+
+    double *xs = allocate_samples(width);
+    double *ys = allocate_samples(width);
+
+    for (int x = 0; x < width; x++)
+        xs[x] = xmin + (double)x / width * (xmax - xmin);
+
+    // a thick point reaches this far past the visible range
+    double margin = (thickness + 1.0) * (ymax - ymin) / height;
+
+    for (int start = 0; start < width; start += PLOT_BLOCK_COLUMNS)
+    {
+        int count = (width - start < PLOT_BLOCK_COLUMNS) ? width - start : PLOT_BLOCK_COLUMNS;
+
+        if (count > 2 && block_is_off_screen(p, xs[start], xs[start + count - 1], ymin - margin, ymax + margin))
+        {
+            // only the end columns are needed, to draw the lines entering and leaving the block
+            ys[start] = polynomial_evaluate(p, xs[start]);
+            ys[start + count - 1] = polynomial_evaluate(p, xs[start + count - 1]);
+
+            for (int x = start + 1; x < start + count - 1; x++)
+                ys[x] = NAN;
+
+            continue;
+        }
+
+        // float is enough unless a value may sit on a row boundary
+        double error = polynomial_evaluate_many_float(p, xs + start, ys + start, count);
+
+        if (!rows_are_certain(ys + start, count, error, ymin, ymax, height))
+            polynomial_evaluate_many(p, xs + start, ys + start, count);
+    }
+
+    draw_samples(image, width, height, ys, ymin, ymax, thickness);
+
+    free(xs);
+    free(ys);
+}
@@ -1,30 +1,35 @@
 // polynomial_arithmetic.c
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
 #include <math.h>
 
 #include "polynomial.h"
+#include "coefficient_arithmetic.h"
 
 static void trim_coefficients(Polynomial *p);
 
-static void normalize_polynomial(Polynomial *p)
+// drops exactly zero leading coefficients, keeping the allocation
+static void trim_degree(Polynomial *p)
 {
-    if (!p || p->degree < 0)
-        return;
-
-    while (p->degree >= 0 &&
-           fabs(p->coefficients[p->degree]) < 1e-9)
-    {
+    while (p->degree > 0 && p->coefficients[p->degree] == 0)
         p->degree--;
-    }
+}
 
-    if (p->degree < 0)
-    {
-        p->degree = 0;
-        p->coefficients[0] = 0.0;
-    }
+// out[0 .. p1->degree + p2->degree] = p1 * p2; out must not overlap the operands
+static void multiply_coefficients(const Polynomial *p1, const Polynomial *p2, double *out)
+{
+    const double *a = p1->coefficients;
+    const double *b = p2->coefficients;
 
-    trim_coefficients(p);
+    // integer operands get an exact product, so no rounding noise is left for the
+    // 1e-9 cut-off in polynomial_divide to mistake for a real coefficient
+    bool exact = polynomial_is_integer(p1) && polynomial_is_integer(p2) &&
+                 coefficients_multiply_integer(a, p1->degree + 1, b, p2->degree + 1, out);
+
+    if (!exact)
+        coefficients_multiply(a, p1->degree + 1, b, p2->degree + 1, out);
 }
 
 static void trim_coefficients(Polynomial *p)
@@ -52,6 +57,7 @@ static void trim_coefficients(Polynomial *p)
 
     // free(p->coefficients);
     p->coefficients = new_coefficients;
+    p->capacity = p->degree + 1;
 }
 
 Polynomial polynomial_add(const Polynomial *p1, const Polynomial *p2)
@@ -135,16 +141,15 @@ Polynomial polynomial_subtract(const Polynomial *p1, const Polynomial *p2)
 Polynomial polynomial_multiply(const Polynomial *p1, const Polynomial *p2)
 {
     int degree = p1->degree + p2->degree;
-    double *coefficients = calloc(degree + 1, sizeof(double));
-
-    for (int i = 0; i <= p1->degree; i++)
+    double *coefficients = malloc((degree + 1) * sizeof(double));
+    if (!coefficients)
     {
-        for (int j = 0; j <= p2->degree; j++)
-        {
-            coefficients[i + j] += p1->coefficients[i] * p2->coefficients[j];
-        }
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
     }
 
+    multiply_coefficients(p1, p2, coefficients);
+
     Polynomial result = create_polynomial(coefficients, degree);
     free(coefficients);
 
@@ -171,6 +176,180 @@ Polynomial polynomial_scalar_multiply(const Polynomial *p, double scalar)
     return nnewPoly;
 }
 
+void polynomial_add_into(Polynomial *dst, const Polynomial *p1, const Polynomial *p2)
+{
+    int degree1 = p1->degree;
+    int degree2 = p2->degree;
+    int max_degree = (degree1 > degree2) ? degree1 : degree2;
+
+    // operands are read through dst after a possible reallocation when they alias it
+    polynomial_reserve(dst, max_degree);
+
+    const double *a = p1->coefficients;
+    const double *b = p2->coefficients;
+    double *out = dst->coefficients;
+
+    for (int i = 0; i <= max_degree; i++)
+    {
+        double coef1 = (i <= degree1) ? a[i] : 0;
+        double coef2 = (i <= degree2) ? b[i] : 0;
+        out[i] = coef1 + coef2;
+    }
+
+    dst->degree = max_degree;
+    trim_degree(dst);
+}
+
+void polynomial_subtract_into(Polynomial *dst, const Polynomial *p1, const Polynomial *p2)
+{
+    int degree1 = p1->degree;
+    int degree2 = p2->degree;
+    int max_degree = (degree1 > degree2) ? degree1 : degree2;
+
+    polynomial_reserve(dst, max_degree);
+
+    const double *a = p1->coefficients;
+    const double *b = p2->coefficients;
+    double *out = dst->coefficients;
+
+    for (int i = 0; i <= max_degree; i++)
+    {
+        double coef1 = (i <= degree1) ? a[i] : 0;
+        double coef2 = (i <= degree2) ? b[i] : 0;
+        out[i] = coef1 - coef2;
+    }
+
+    dst->degree = max_degree;
+    trim_degree(dst);
+}
+
+void polynomial_multiply_into(Polynomial *dst, const Polynomial *p1, const Polynomial *p2)
+{
+    int degree = p1->degree + p2->degree;
+
+    // the product cannot be formed over its own operand, so aliasing costs a buffer
+    if (dst == p1 || dst == p2)
+    {
+        double *coefficients = malloc((degree + 1) * sizeof(double));
+        if (!coefficients)
+        {
+            perror("malloc failed");
+            exit(EXIT_FAILURE);
+        }
+
+        multiply_coefficients(p1, p2, coefficients);
+
+        if (dst->capacity > 0)
+            free(dst->coefficients);
+        dst->coefficients = coefficients;
+        dst->capacity = degree + 1;
+    }
+    else
+    {
+        polynomial_reserve(dst, degree);
+        multiply_coefficients(p1, p2, dst->coefficients);
+    }
+
+    dst->degree = degree;
+    trim_degree(dst);
+}
+
+Polynomial polynomial_pow(const Polynomial *p, int k)
+{
+    return polynomial_pow_truncated(p, k, INT_MAX - 1);
+}
+
+// Binary exponentiation: log2(k) squarings and at most as many products, over three
+// buffers allocated once. Integer bases stay exact through the NTT products.
+Polynomial polynomial_pow_truncated(const Polynomial *p, int k, int max_degree)
+{
+    // the halving loop below never reaches zero for negative k
+    if (k < 0 || max_degree < 0)
+        return create_zero_polynomial();
+
+    if (k == 0)
+        return create_monomial(0, 1.0);
+
+    long long full_degree = (long long)p->degree * k;
+    size_t len = (size_t)((full_degree < max_degree) ? full_degree : max_degree) + 1;
+
+    double *result = malloc((2 * len - 1) * sizeof(double));
+    double *base = malloc((2 * len - 1) * sizeof(double));
+    double *product = malloc((2 * len - 1) * sizeof(double));
+    if (!result || !base || !product)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t base_len = ((size_t)p->degree + 1 < len) ? (size_t)p->degree + 1 : len;
+    memcpy(base, p->coefficients, base_len * sizeof(double));
+
+    bool integer = polynomial_is_integer(p);
+
+    // result is 1 until the first set bit, so that product is a copy
+    size_t result_len = 0;
+
+    for (;;)
+    {
+        if (k & 1)
+        {
+            if (result_len == 0)
+            {
+                memcpy(result, base, base_len * sizeof(double));
+                result_len = base_len;
+            }
+            else
+            {
+                if (!integer || !coefficients_multiply_integer(result, result_len, base, base_len, product))
+                    coefficients_multiply(result, result_len, base, base_len, product);
+
+                double *swap = result;
+                result = product;
+                product = swap;
+
+                result_len = (result_len + base_len - 1 < len) ? result_len + base_len - 1 : len;
+            }
+        }
+
+        k >>= 1;
+        if (k == 0)
+            break;
+
+        if (!integer || !coefficients_multiply_integer(base, base_len, base, base_len, product))
+            coefficients_multiply(base, base_len, base, base_len, product);
+
+        double *swap = base;
+        base = product;
+        product = swap;
+
+        base_len = (2 * base_len - 1 < len) ? 2 * base_len - 1 : len;
+    }
+
+    Polynomial power = create_polynomial(result, (int)result_len - 1);
+
+    free(result);
+    free(base);
+    free(product);
+
+    trim_coefficients(&power);
+
+    return power;
+}
+
+void polynomial_scale_in_place(Polynomial *p, double scalar)
+{
+    if (scalar == 0.0)
+    {
+        p->degree = 0;
+        p->coefficients[0] = 0.0;
+        return;
+    }
+
+    for (int i = 0; i <= p->degree; i++)
+        p->coefficients[i] *= scalar;
+}
+
 Polynomial polynomial_divide(const Polynomial *p1, const Polynomial *p2, Polynomial *rest)
 {
     if (p1 == NULL || p2 == NULL)
@@ -183,37 +362,189 @@ Polynomial polynomial_divide(const Polynomial *p1, const Polynomial *p2, Polynom
         return copy_polynomial(p1);
     }
 
-    Polynomial result = create_zero_polynomial();
-    Polynomial poly_to_devide = copy_polynomial(p1);
+    int m = p2->degree;
+    int degree = p1->degree;
+    double lead = p2->coefficients[m];
 
-    while (poly_to_devide.degree >= p2->degree &&
-           !polynomial_is_zero(&poly_to_devide))
+    // the remainder is worked down in place; each step cancels its leading term and
+    // then drops leading coefficients below 1e-9
+    double *remainder = malloc((degree + 1) * sizeof(double));
+    double *quotient = calloc((degree >= m) ? degree - m + 1 : 1, sizeof(double));
+
+    if (!remainder || !quotient)
     {
-        Polynomial monomial = create_monomial(poly_to_devide.degree - p2->degree, poly_to_devide.coefficients[poly_to_devide.degree] / p2->coefficients[p2->degree]);
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
 
-        Polynomial add_result = polynomial_add(&result, &monomial);
+    if (degree - m + 1 >= NEWTON_DIVISION_THRESHOLD && m >= NEWTON_DIVISION_THRESHOLD)
+    {
+        // long quotient and divisor: Newton's iteration, then the same cut-off on
+        // the remainder's leading coefficients
+        coefficients_divide(p1->coefficients, degree + 1, p2->coefficients, m + 1, quotient, remainder);
+
+        degree = m - 1;
+        while (degree > 0 && fabs(remainder[degree]) < 1e-9)
+            degree--;
+        if (fabs(remainder[0]) < 1e-9 && degree == 0)
+            remainder[0] = 0.0;
+    }
+    else
+        memcpy(remainder, p1->coefficients, (degree + 1) * sizeof(double));
 
-        free_polynomial(&result);
+    while (degree >= m && !(degree == 0 && remainder[0] == 0))
+    {
+        double q = remainder[degree] / lead;
+        int shift = degree - m;
 
-        result = add_result;
+        quotient[shift] = q;
 
-        Polynomial poly_to_subtract = polynomial_multiply(&monomial, p2);
+        for (int j = 0; j < m; j++)
+            remainder[shift + j] -= q * p2->coefficients[j];
+        remainder[degree] = 0.0;
 
-        free_polynomial(&monomial);
+        while (degree >= 0 && fabs(remainder[degree]) < 1e-9)
+            degree--;
 
-        Polynomial subtract_result = polynomial_subtract(&poly_to_devide, &poly_to_subtract);
+        if (degree < 0)
+        {
+            degree = 0;
+            remainder[0] = 0.0;
+        }
+    }
 
-        free_polynomial(&poly_to_devide);
-        free_polynomial(&poly_to_subtract);
+    int quotient_degree = (p1->degree >= m) ? p1->degree - m : 0;
+    while (quotient_degree > 0 && quotient[quotient_degree] == 0)
+        quotient_degree--;
 
-        poly_to_devide = subtract_result;
-        normalize_polynomial(&poly_to_devide);
-    }
+    Polynomial result = create_polynomial(quotient, quotient_degree);
 
     if (rest)
-        *rest = poly_to_devide;
-    else
-        free_polynomial(&poly_to_devide);
+        *rest = create_polynomial(remainder, degree);
+
+    free(remainder);
+    free(quotient);
 
     return result;
-}
\ No newline at end of file
+}
+
+double polynomial_deflate_linear(Polynomial *p, double root, DeflationDirection direction)
+{
+    double *a = p->coefficients;
+    int n = p->degree;
+
+    if (n == 0)
+    {
+        double left_over = a[0];
+        a[0] = 0.0;
+        return left_over;
+    }
+
+    if (direction == DEFLATION_AUTO)
+        direction = (fabs(root) > 1.0) ? DEFLATION_BACKWARD : DEFLATION_FORWARD;
+    if (root == 0.0)
+        direction = DEFLATION_FORWARD;
+
+    double left_over;
+
+    if (direction == DEFLATION_FORWARD)
+    {
+        // q_(k-1) = a_k + root q_k, written over a_k's lower neighbour
+        double carry = a[n];
+        for (int k = n - 1; k >= 0; k--)
+        {
+            double next = a[k] + root * carry;
+            a[k] = carry;
+            carry = next;
+        }
+        left_over = carry;
+    }
+    else
+    {
+        // q_0 = -a_0 / root, q_k = (q_(k-1) - a_k) / root
+        double previous = 0.0;
+        for (int k = 0; k < n; k++)
+        {
+            a[k] = (previous - a[k]) / root;
+            previous = a[k];
+        }
+        left_over = a[n] - previous;
+    }
+
+    p->degree = n - 1;
+
+    return left_over;
+}
+
+void polynomial_deflate_quadratic(Polynomial *p, double b, double c, DeflationDirection direction,
+                                  double *left_over)
+{
+    double *a = p->coefficients;
+    int n = p->degree;
+
+    if (n < 2)
+    {
+        if (left_over)
+        {
+            left_over[0] = a[0];
+            left_over[1] = (n == 1) ? a[1] : 0.0;
+        }
+
+        p->degree = 0;
+        a[0] = 0.0;
+        return;
+    }
+
+    if (direction == DEFLATION_AUTO)
+        direction = (fabs(c) > 1.0) ? DEFLATION_BACKWARD : DEFLATION_FORWARD;
+    if (c == 0.0)
+        direction = DEFLATION_FORWARD;
+
+    double first;
+    double second;
+
+    if (direction == DEFLATION_FORWARD)
+    {
+        // q_(k-2) = a_k - b q_(k-1) - c q_k, stored over a_k and shifted down after
+        double q1 = 0.0; // q_(k-1)
+        double q2 = 0.0; // q_k
+        for (int k = n; k >= 2; k--)
+        {
+            double q = a[k] - b * q1 - c * q2;
+            a[k] = q;
+            q2 = q1;
+            q1 = q;
+        }
+
+        // remainder r_1 x + r_0
+        first = a[0] - c * q1;
+        second = a[1] - b * q1 - c * q2;
+
+        memmove(a, a + 2, (n - 1) * sizeof(double));
+    }
+    else
+    {
+        // c q_k = a_k - b q_(k-1) - q_(k-2), from the constant upwards
+        double q1 = 0.0; // q_(k-1)
+        double q2 = 0.0; // q_(k-2)
+        for (int k = 0; k <= n - 2; k++)
+        {
+            double q = (a[k] - b * q1 - q2) / c;
+            a[k] = q;
+            q2 = q1;
+            q1 = q;
+        }
+
+        // mismatch in the two leading coefficients
+        first = a[n - 1] - q2 - b * q1;
+        second = a[n] - q1;
+    }
+
+    p->degree = n - 2;
+
+    if (left_over)
+    {
+        left_over[0] = first;
+        left_over[1] = second;
+    }
+}
@@ -0,0 +1,281 @@
+// polynomial_batch.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "polynomial_batch.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Points per tile; the power block of a tile is reused by every polynomial
+#define BATCH_POINT_TILE 128
+
+// Register block of the inner kernel: polynomials x points
+#define BATCH_ROW_BLOCK 4
+#define BATCH_POINT_LANES 16
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+PolynomialBatch create_polynomial_batch(const Polynomial *polynomials, int count)
+{
+    PolynomialBatch batch = {.count = count, .max_degree = 0};
+
+    for (int i = 0; i < count; i++)
+    {
+        if (polynomials[i].degree > batch.max_degree)
+            batch.max_degree = polynomials[i].degree;
+    }
+
+    size_t stride = (size_t)batch.max_degree + 1;
+
+    batch.coefficients = calloc((size_t)count * stride, sizeof(double));
+    if (!batch.coefficients)
+    {
+        perror("calloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < count; i++)
+        memcpy(batch.coefficients + i * stride, polynomials[i].coefficients,
+               (polynomials[i].degree + 1) * sizeof(double));
+
+    return batch;
+}
+
+void free_polynomial_batch(PolynomialBatch *batch)
+{
+    free(batch->coefficients);
+    batch->coefficients = NULL;
+    batch->count = 0;
+    batch->max_degree = 0;
+}
+
+// powers[j * tile + k] = xs[k]^j
+static void build_power_block(const double *xs, size_t tile, int degree, double *powers)
+{
+    for (size_t k = 0; k < tile; k++)
+        powers[k] = 1.0;
+
+    for (int j = 1; j <= degree; j++)
+    {
+        const double *previous = powers + (j - 1) * tile;
+        double *row = powers + j * tile;
+
+        for (size_t k = 0; k < tile; k++)
+            row[k] = previous[k] * xs[k];
+    }
+}
+
+typedef void (*BatchBlockKernel)(const double *const *c, int degree,
+                                 const double *powers, size_t tile, size_t k0,
+                                 double *const *y);
+
+// BATCH_ROW_BLOCK x BATCH_POINT_LANES results accumulated across the whole
+// coefficient loop; every power row segment is loaded once for the block of rows
+static void multiply_block_scalar(const double *const *c, int degree,
+                                  const double *powers, size_t tile, size_t k0,
+                                  double *const *y)
+{
+    double acc[BATCH_ROW_BLOCK][BATCH_POINT_LANES];
+
+    for (int r = 0; r < BATCH_ROW_BLOCK; r++)
+        for (int l = 0; l < BATCH_POINT_LANES; l++)
+            acc[r][l] = c[r][0];
+
+    for (int j = 1; j <= degree; j++)
+    {
+        const double *row = powers + j * tile + k0;
+
+        for (int r = 0; r < BATCH_ROW_BLOCK; r++)
+        {
+            double cj = c[r][j];
+            for (int l = 0; l < BATCH_POINT_LANES; l++)
+                acc[r][l] += cj * row[l];
+        }
+    }
+
+    for (int r = 0; r < BATCH_ROW_BLOCK; r++)
+        for (int l = 0; l < BATCH_POINT_LANES; l++)
+            y[r][k0 + l] = acc[r][l];
+}
+
+#ifdef HAVE_X86_SIMD
+
+// The vector kernels spell out the four rows so that the eight accumulators stay in
+// registers; the loop is then bound by fma throughput instead of a Horner chain.
+
+__attribute__((target("avx2,fma"))) static void multiply_block_avx2(const double *const *c, int degree,
+                                                                   const double *powers, size_t tile, size_t k0,
+                                                                   double *const *y)
+{
+    for (int half = 0; half < BATCH_POINT_LANES; half += 8)
+    {
+        __m256d a00 = _mm256_set1_pd(c[0][0]), a01 = a00;
+        __m256d a10 = _mm256_set1_pd(c[1][0]), a11 = a10;
+        __m256d a20 = _mm256_set1_pd(c[2][0]), a21 = a20;
+        __m256d a30 = _mm256_set1_pd(c[3][0]), a31 = a30;
+
+        for (int j = 1; j <= degree; j++)
+        {
+            const double *row = powers + j * tile + k0 + half;
+            __m256d p0 = _mm256_loadu_pd(row);
+            __m256d p1 = _mm256_loadu_pd(row + 4);
+
+            __m256d c0 = _mm256_set1_pd(c[0][j]);
+            __m256d c1 = _mm256_set1_pd(c[1][j]);
+            __m256d c2 = _mm256_set1_pd(c[2][j]);
+            __m256d c3 = _mm256_set1_pd(c[3][j]);
+
+            a00 = _mm256_fmadd_pd(c0, p0, a00);
+            a01 = _mm256_fmadd_pd(c0, p1, a01);
+            a10 = _mm256_fmadd_pd(c1, p0, a10);
+            a11 = _mm256_fmadd_pd(c1, p1, a11);
+            a20 = _mm256_fmadd_pd(c2, p0, a20);
+            a21 = _mm256_fmadd_pd(c2, p1, a21);
+            a30 = _mm256_fmadd_pd(c3, p0, a30);
+            a31 = _mm256_fmadd_pd(c3, p1, a31);
+        }
+
+        _mm256_storeu_pd(y[0] + k0 + half, a00);
+        _mm256_storeu_pd(y[0] + k0 + half + 4, a01);
+        _mm256_storeu_pd(y[1] + k0 + half, a10);
+        _mm256_storeu_pd(y[1] + k0 + half + 4, a11);
+        _mm256_storeu_pd(y[2] + k0 + half, a20);
+        _mm256_storeu_pd(y[2] + k0 + half + 4, a21);
+        _mm256_storeu_pd(y[3] + k0 + half, a30);
+        _mm256_storeu_pd(y[3] + k0 + half + 4, a31);
+    }
+}
+
+__attribute__((target("avx512f"))) static void multiply_block_avx512(const double *const *c, int degree,
+                                                                    const double *powers, size_t tile, size_t k0,
+                                                                    double *const *y)
+{
+    __m512d a00 = _mm512_set1_pd(c[0][0]), a01 = a00;
+    __m512d a10 = _mm512_set1_pd(c[1][0]), a11 = a10;
+    __m512d a20 = _mm512_set1_pd(c[2][0]), a21 = a20;
+    __m512d a30 = _mm512_set1_pd(c[3][0]), a31 = a30;
+
+    for (int j = 1; j <= degree; j++)
+    {
+        const double *row = powers + j * tile + k0;
+        __m512d p0 = _mm512_loadu_pd(row);
+        __m512d p1 = _mm512_loadu_pd(row + 8);
+
+        __m512d c0 = _mm512_set1_pd(c[0][j]);
+        __m512d c1 = _mm512_set1_pd(c[1][j]);
+        __m512d c2 = _mm512_set1_pd(c[2][j]);
+        __m512d c3 = _mm512_set1_pd(c[3][j]);
+
+        a00 = _mm512_fmadd_pd(c0, p0, a00);
+        a01 = _mm512_fmadd_pd(c0, p1, a01);
+        a10 = _mm512_fmadd_pd(c1, p0, a10);
+        a11 = _mm512_fmadd_pd(c1, p1, a11);
+        a20 = _mm512_fmadd_pd(c2, p0, a20);
+        a21 = _mm512_fmadd_pd(c2, p1, a21);
+        a30 = _mm512_fmadd_pd(c3, p0, a30);
+        a31 = _mm512_fmadd_pd(c3, p1, a31);
+    }
+
+    _mm512_storeu_pd(y[0] + k0, a00);
+    _mm512_storeu_pd(y[0] + k0 + 8, a01);
+    _mm512_storeu_pd(y[1] + k0, a10);
+    _mm512_storeu_pd(y[1] + k0 + 8, a11);
+    _mm512_storeu_pd(y[2] + k0, a20);
+    _mm512_storeu_pd(y[2] + k0 + 8, a21);
+    _mm512_storeu_pd(y[3] + k0, a30);
+    _mm512_storeu_pd(y[3] + k0 + 8, a31);
+}
+
+#endif // HAVE_X86_SIMD
+
+// dispatched on the level polynomial_simd_level caches
+static BatchBlockKernel block_kernel(void)
+{
+    switch (polynomial_simd_level())
+    {
+#ifdef HAVE_X86_SIMD
+    case SIMD_LEVEL_AVX512:
+        return multiply_block_avx512;
+    case SIMD_LEVEL_AVX2:
+        return multiply_block_avx2;
+#endif
+    default:
+        return multiply_block_scalar;
+    }
+}
+
+// out rows [first, first + rows) over one tile of points
+static void multiply_row_block(const PolynomialBatch *batch, int first, int rows,
+                               const double *powers, size_t tile,
+                               double *out, size_t m)
+{
+    size_t stride = (size_t)batch->max_degree + 1;
+
+    const double *c[BATCH_ROW_BLOCK];
+    double *y[BATCH_ROW_BLOCK];
+
+    for (int r = 0; r < rows; r++)
+    {
+        c[r] = batch->coefficients + (first + r) * stride;
+        y[r] = out + (first + r) * m;
+    }
+
+    size_t k = 0;
+
+    if (rows == BATCH_ROW_BLOCK)
+    {
+        BatchBlockKernel kernel = block_kernel();
+
+        for (; k + BATCH_POINT_LANES <= tile; k += BATCH_POINT_LANES)
+            kernel(c, batch->max_degree, powers, tile, k, y);
+    }
+
+    // partial row blocks and the tail of the tile
+    for (int r = 0; r < rows; r++)
+    {
+        for (size_t t = k; t < tile; t++)
+        {
+            double sum = c[r][0];
+            for (int j = 1; j <= batch->max_degree; j++)
+                sum += c[r][j] * powers[j * tile + t];
+            y[r][t] = sum;
+        }
+    }
+}
+
+void polynomial_batch_evaluate(const PolynomialBatch *batch, const double *xs, size_t m, double *out)
+{
+    if (batch->count == 0 || m == 0)
+        return;
+
+    double *powers = allocate_or_exit(((size_t)batch->max_degree + 1) * BATCH_POINT_TILE * sizeof(double));
+
+    for (size_t start = 0; start < m; start += BATCH_POINT_TILE)
+    {
+        size_t tile = (m - start < BATCH_POINT_TILE) ? m - start : BATCH_POINT_TILE;
+
+        build_power_block(xs + start, tile, batch->max_degree, powers);
+
+        for (int first = 0; first < batch->count; first += BATCH_ROW_BLOCK)
+        {
+            int rows = (batch->count - first < BATCH_ROW_BLOCK) ? batch->count - first : BATCH_ROW_BLOCK;
+
+            multiply_row_block(batch, first, rows, powers, tile, out + start, m);
+        }
+    }
+
+    free(powers);
+}
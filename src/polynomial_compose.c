@@ -0,0 +1,183 @@
+// polynomial_compose.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "polynomial.h"
+#include "coefficient_arithmetic.h"
+
+// Length of p up to which composition runs Horner's rule (the classic shift for
+// x + a) instead of splitting p in halves
+#ifndef COMPOSE_THRESHOLD
+#define COMPOSE_THRESHOLD 64
+#endif
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+// c(x) -> c(x + a) in place by repeated synthetic division, n^2 / 2 multiply-adds
+// running over contiguous memory
+static void taylor_shift_classic(double *c, size_t len, double a)
+{
+    for (size_t i = 0; i + 1 < len; i++)
+        for (size_t j = len - 2; j + 1 > i; j--)
+            c[j] += a * c[j + 1];
+}
+
+// Integer operands get exact products, as in polynomial_multiply
+static void multiply(const double *a, size_t a_len, const double *b, size_t b_len, double *out)
+{
+    if (!coefficients_multiply_integer(a, a_len, b, b_len, out))
+        coefficients_multiply(a, a_len, b, b_len, out);
+}
+
+// out = p(q) by Horner's rule, each step one product with q
+static void compose_horner(const double *p, size_t p_len, const double *q, size_t q_len, double *out)
+{
+    size_t out_len = (p_len - 1) * (q_len - 1) + 1;
+    double *product = allocate_or_exit(out_len * sizeof(double));
+
+    out[0] = p[p_len - 1];
+    size_t len = 1;
+
+    for (size_t i = p_len - 1; i-- > 0;)
+    {
+        multiply(out, len, q, q_len, product);
+        len += q_len - 1;
+
+        memcpy(out, product, len * sizeof(double));
+        out[0] += p[i];
+    }
+
+    free(product);
+}
+
+// out = p(q) with p = low + q^m high for m the largest power of two below p_len;
+// powers[k] holds q^(2^k). Both halves recurse, so the work is a logarithmic number
+// of levels of balanced products rather than p_len unbalanced ones.
+static void compose_recursive(const double *p, size_t p_len, const double *q, size_t q_len,
+                              double *const *powers, double *out)
+{
+    size_t d = q_len - 1;
+
+    if (p_len <= COMPOSE_THRESHOLD)
+    {
+        if (q_len == 2 && q[1] == 1.0)
+        {
+            memcpy(out, p, p_len * sizeof(double));
+            taylor_shift_classic(out, p_len, q[0]);
+        }
+        else
+        {
+            compose_horner(p, p_len, q, q_len, out);
+        }
+        return;
+    }
+
+    int k = 0;
+    size_t m = 1;
+    while (2 * m < p_len)
+    {
+        m *= 2;
+        k++;
+    }
+
+    size_t low_len = (m - 1) * d + 1;
+    size_t high_len = (p_len - m - 1) * d + 1;
+
+    double *high = allocate_or_exit(high_len * sizeof(double));
+
+    compose_recursive(p, m, q, q_len, powers, out);
+    compose_recursive(p + m, p_len - m, q, q_len, powers, high);
+
+    // the product fills the whole result; the low part adds onto its first terms
+    double *product = allocate_or_exit((high_len + m * d) * sizeof(double));
+    multiply(high, high_len, powers[k], m * d + 1, product);
+
+    for (size_t i = 0; i < low_len; i++)
+        product[i] += out[i];
+
+    memcpy(out, product, (high_len + m * d) * sizeof(double));
+
+    free(high);
+    free(product);
+}
+
+static void compose_coefficients(const double *p, size_t p_len, const double *q, size_t q_len, double *out)
+{
+    size_t d = q_len - 1;
+
+    // q^(2^k) for every power of two below p_len
+    int levels = 0;
+    while (((size_t)1 << (levels + 1)) < p_len)
+        levels++;
+
+    double **powers = allocate_or_exit((levels + 1) * sizeof(double *));
+
+    powers[0] = allocate_or_exit(q_len * sizeof(double));
+    memcpy(powers[0], q, q_len * sizeof(double));
+
+    for (int k = 1; k <= levels; k++)
+    {
+        size_t len = ((size_t)1 << (k - 1)) * d + 1;
+
+        powers[k] = allocate_or_exit((2 * len - 1) * sizeof(double));
+        multiply(powers[k - 1], len, powers[k - 1], len, powers[k]);
+    }
+
+    compose_recursive(p, p_len, q, q_len, powers, out);
+
+    for (int k = 0; k <= levels; k++)
+        free(powers[k]);
+    free(powers);
+}
+
+Polynomial polynomial_compose(const Polynomial *p, const Polynomial *q)
+{
+    // a constant on either side leaves a constant
+    if (p->degree == 0 || q->degree == 0)
+    {
+        double value = polynomial_evaluate(p, q->coefficients[0]);
+        return create_polynomial(&value, 0);
+    }
+
+    int degree = p->degree * q->degree;
+    double *out = allocate_or_exit((degree + 1) * sizeof(double));
+
+    compose_coefficients(p->coefficients, p->degree + 1, q->coefficients, q->degree + 1, out);
+
+    Polynomial result = create_polynomial(out, degree);
+    free(out);
+
+    return result;
+}
+
+Polynomial polynomial_taylor_shift(const Polynomial *p, double a)
+{
+    size_t len = p->degree + 1;
+    double *out = allocate_or_exit(len * sizeof(double));
+
+    if (len <= COMPOSE_THRESHOLD)
+    {
+        memcpy(out, p->coefficients, len * sizeof(double));
+        taylor_shift_classic(out, len, a);
+    }
+    else
+    {
+        double q[] = {a, 1.0};
+        compose_coefficients(p->coefficients, len, q, 2, out);
+    }
+
+    Polynomial result = create_polynomial(out, p->degree);
+    free(out);
+
+    return result;
+}
@@ -1,16 +1,21 @@
 // polynomial_compute.c
 #include <math.h>
+#include <float.h>
 
 #include "polynomial.h"
+#include "polynomial_kernels.h"
 #include "extended_value.h"
 
-double newton_raphson_polynomial(const Polynomial *p, const Polynomial *prime, double x0, double tol, int max_iter)
+double newton_raphson_polynomial(const Polynomial *p, double x0, double tol, int max_iter)
 {
     double x = x0;
     for (int i = 0; i < max_iter; i++)
     {
-        double fx = polynomial_evaluate(p, x);
-        double fpx = polynomial_evaluate(prime, x);
+        double values[2];
+        polynomial_evaluate_with_derivatives(p, x, 1, values);
+
+        double fx = values[0];
+        double fpx = values[1];
 
         if (fabs(fpx) < 1e-12)
         {
@@ -29,16 +34,215 @@ double newton_raphson_polynomial(const Polynomial *p, const Polynomial *prime, d
     return x; // Return best guess
 }
 
-double polynomial_evaluate(const Polynomial *p, double x)
+// Degree above which the automatic scheme switches from Horner to Estrin; the
+// unrolled Horner kernels end here because Estrin is faster beyond it
+#define ESTRIN_DEGREE_THRESHOLD POLYNOMIAL_KERNEL_MAX_DEGREE
+
+// Coefficients per Estrin block
+#define ESTRIN_BLOCK_SIZE 8
+
+static double evaluate_horner(const double *c, int degree, double x)
+{
+    if (degree <= POLYNOMIAL_KERNEL_MAX_DEGREE)
+        return polynomial_evaluation_kernels[degree](c, x);
+
+    double result = c[degree];
+    for (int i = degree - 1; i >= 0; i--)
+    {
+        result = HORNER_STEP(result, x, c[i]);
+    }
+    return result;
+}
+
+// c[0] + c[1]x + ... + c[7]x^7 as a tree of independent multiply-adds
+static double evaluate_estrin_block(const double *c, double x, double x2, double x4)
+{
+    double p01 = HORNER_STEP(c[1], x, c[0]);
+    double p23 = HORNER_STEP(c[3], x, c[2]);
+    double p45 = HORNER_STEP(c[5], x, c[4]);
+    double p67 = HORNER_STEP(c[7], x, c[6]);
+
+    double p0123 = HORNER_STEP(p23, x2, p01);
+    double p4567 = HORNER_STEP(p67, x2, p45);
+
+    return HORNER_STEP(p4567, x4, p0123);
+}
+
+// Blocks of eight coefficients are evaluated with Estrin's scheme and chained by
+// Horner in x^8, so the serial dependency is degree / 8 steps instead of degree.
+static double evaluate_estrin(const double *c, int degree, double x)
 {
+    double x2 = x * x;
+    double x4 = x2 * x2;
+    double x8 = x4 * x4;
+
+    int full_blocks = (degree + 1) / ESTRIN_BLOCK_SIZE;
+    int tail_start = full_blocks * ESTRIN_BLOCK_SIZE;
+
     double result = 0.0;
-    for (int i = 0; i <= p->degree; i++)
+    if (tail_start <= degree)
+        result = evaluate_horner(c + tail_start, degree - tail_start, x);
+
+    for (int block = full_blocks - 1; block >= 0; block--)
     {
-        result += p->coefficients[i] * pow(x, i);
+        double value = evaluate_estrin_block(c + block * ESTRIN_BLOCK_SIZE, x, x2, x4);
+        result = HORNER_STEP(result, x8, value);
     }
+
     return result;
 }
 
+// a + b == *sum + *error exactly (Knuth's TwoSum)
+static void two_sum(double a, double b, double *sum, double *error)
+{
+    double s = a + b;
+    double bb = s - a;
+    *error = (a - (s - bb)) + (b - bb);
+    *sum = s;
+}
+
+// a * b == *product + *error exactly
+static void two_product(double a, double b, double *product, double *error)
+{
+    double p = a * b;
+#ifdef FP_FAST_FMA
+    *error = fma(a, b, -p);
+#else
+    // Dekker's product with Veltkamp splitting
+    const double splitter = 134217729.0; // 2^27 + 1
+
+    double ta = splitter * a;
+    double a_high = ta - (ta - a);
+    double a_low = a - a_high;
+
+    double tb = splitter * b;
+    double b_high = tb - (tb - b);
+    double b_low = b - b_high;
+
+    *error = a_low * b_low - (((p - a_high * b_high) - a_low * b_high) - a_high * b_low);
+#endif
+    *product = p;
+}
+
+// Horner's scheme that also runs Horner on the exact rounding errors of every step;
+// the result is as accurate as if computed in twice the working precision.
+static double evaluate_compensated(const double *c, int degree, double x)
+{
+    double result = c[degree];
+    double correction = 0.0;
+
+    for (int i = degree - 1; i >= 0; i--)
+    {
+        double product, product_error;
+        double sum_error;
+
+        two_product(result, x, &product, &product_error);
+        two_sum(product, c[i], &result, &sum_error);
+
+        correction = correction * x + (product_error + sum_error);
+    }
+
+    return result + correction;
+}
+
+double polynomial_evaluate_with_scheme(const Polynomial *p, double x, EvaluationScheme scheme)
+{
+    switch (scheme)
+    {
+    case EVALUATION_HORNER:
+        return evaluate_horner(p->coefficients, p->degree, x);
+    case EVALUATION_ESTRIN:
+        return evaluate_estrin(p->coefficients, p->degree, x);
+    case EVALUATION_COMPENSATED:
+        return evaluate_compensated(p->coefficients, p->degree, x);
+    case EVALUATION_AUTO:
+    default:
+        if (p->degree > ESTRIN_DEGREE_THRESHOLD)
+            return evaluate_estrin(p->coefficients, p->degree, x);
+        return evaluate_horner(p->coefficients, p->degree, x);
+    }
+}
+
+double polynomial_evaluate(const Polynomial *p, double x)
+{
+    return polynomial_evaluate_with_scheme(p, x, EVALUATION_AUTO);
+}
+
+// |error| of Horner's scheme is at most gamma(2n) * sum |c_i| |x|^i;
+// the factor 2 covers the rounding of the magnitude itself
+static double horner_error_bound(int degree, double magnitude)
+{
+    double u = DBL_EPSILON / 2.0;
+    double gamma = 2.0 * degree * u / (1.0 - 2.0 * degree * u);
+
+    return 2.0 * gamma * magnitude;
+}
+
+double polynomial_evaluation_error_bound(const Polynomial *p, double x)
+{
+    double magnitude = 0.0;
+    for (int i = p->degree; i >= 0; i--)
+        magnitude = magnitude * fabs(x) + fabs(p->coefficients[i]);
+
+    return horner_error_bound(p->degree, magnitude);
+}
+
+int polynomial_sign_at(const Polynomial *p, double x)
+{
+    const double *c = p->coefficients;
+
+    double value = c[p->degree];
+    double magnitude = fabs(value);
+
+    for (int i = p->degree - 1; i >= 0; i--)
+    {
+        value = HORNER_STEP(value, x, c[i]);
+        magnitude = magnitude * fabs(x) + fabs(c[i]);
+    }
+
+    if (fabs(value) <= horner_error_bound(p->degree, magnitude))
+        value = evaluate_compensated(c, p->degree, x);
+
+    if (value > 0)
+        return 1;
+    if (value < 0)
+        return -1;
+    return 0;
+}
+
+void polynomial_evaluate_with_derivatives(const Polynomial *p, double x, int k, double *out)
+{
+    const double *c = p->coefficients;
+
+    if (k == 1 && p->degree <= POLYNOMIAL_DERIVATIVE_KERNEL_MAX_DEGREE)
+    {
+        polynomial_derivative_kernels[p->degree](c, x, &out[0], &out[1]);
+        return;
+    }
+
+    out[0] = c[p->degree];
+    for (int j = 1; j <= k; j++)
+        out[j] = 0.0;
+
+    // out[j] accumulates the j-th Taylor coefficient of p around x
+    for (int i = p->degree - 1; i >= 0; i--)
+    {
+        int top = (p->degree - i < k) ? p->degree - i : k;
+
+        for (int j = top; j >= 1; j--)
+            out[j] = HORNER_STEP(out[j], x, out[j - 1]);
+
+        out[0] = HORNER_STEP(out[0], x, c[i]);
+    }
+
+    double factorial = 1.0;
+    for (int j = 2; j <= k; j++)
+    {
+        factorial *= j;
+        out[j] *= factorial;
+    }
+}
+
 ExtendedValue polynomial_limit(const Polynomial *p, ExtendedValue approach)
 {
     ExtendedValue result;
@@ -280,6 +280,7 @@ Polynomial create_polynomial(const double *coefficients, int degree)
         perror("malloc failed");
         exit(EXIT_FAILURE);
     }
+    p.capacity = degree + 1;
 
     for (int i = 0; i <= degree; i++)
         p.coefficients[i] = coefficients[i];
@@ -351,11 +352,62 @@ Polynomial polynomial_derivative(const Polynomial *p)
     return result;
 }
 
+void polynomial_derivative_into(Polynomial *dst, const Polynomial *p)
+{
+    if (p->degree <= 0)
+    {
+        polynomial_reserve(dst, 0);
+        dst->degree = 0;
+        dst->coefficients[0] = 0.0;
+        return;
+    }
+
+    int degree = p->degree;
+    polynomial_reserve(dst, degree - 1);
+
+    // ascending, so dst may be p itself
+    const double *c = p->coefficients;
+    for (int i = 1; i <= degree; i++)
+        dst->coefficients[i - 1] = c[i] * i;
+
+    dst->degree = degree - 1;
+}
+
+void polynomial_reserve(Polynomial *p, int degree)
+{
+    if (degree + 1 <= p->capacity)
+        return;
+
+    double *coefficients;
+
+    if (p->capacity > 0)
+        coefficients = realloc(p->coefficients, (degree + 1) * sizeof(double));
+    else
+    {
+        coefficients = malloc((degree + 1) * sizeof(double));
+        if (coefficients && p->coefficients)
+        {
+            int kept = (p->degree < degree) ? p->degree : degree;
+            memcpy(coefficients, p->coefficients, (kept + 1) * sizeof(double));
+        }
+    }
+
+    if (!coefficients)
+    {
+        perror("realloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    p->coefficients = coefficients;
+    p->capacity = degree + 1;
+}
+
 void free_polynomial(Polynomial *p)
 {
     free(p->coefficients);
     p->coefficients = NULL;
     p->degree = 0;
+    p->capacity = 0;
 
     free(p->formula);
     p->formula = NULL;
@@ -0,0 +1,186 @@
+// polynomial_evaluate_grid.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+
+#include "polynomial.h"
+
+// Accepted drift of the difference table relative to Horner's rounding error bound
+#define GRID_DRIFT_FACTOR 4.0
+
+// Upper limit on the steps advanced between two re-synchronisations
+#define GRID_MAX_RUN 4096
+
+// Interleaved sub-grids advanced side by side
+#define GRID_LANES 8
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+// surjections[j * (n + 1) + k] = k! S(j, k), the number of onto maps from j to k elements
+static double *create_surjection_table(int n)
+{
+    double *table = calloc((size_t)(n + 1) * (n + 1), sizeof(double));
+    if (!table)
+    {
+        perror("calloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    table[0] = 1.0;
+    for (int j = 1; j <= n; j++)
+        for (int k = 1; k <= j; k++)
+            table[j * (n + 1) + k] = k * (table[(j - 1) * (n + 1) + k - 1] + table[(j - 1) * (n + 1) + k]);
+
+    return table;
+}
+
+// Forward differences of p on the grid x, x + dx, ... taken from the Taylor expansion
+// at x, which avoids the cancellation of differencing sampled values.
+static void init_differences(const Polynomial *p, double x, double dx,
+                             const double *surjections, double *taylor, double *differences)
+{
+    int n = p->degree;
+
+    polynomial_evaluate_with_derivatives(p, x, n, taylor);
+
+    double scale = 1.0;
+    double factorial = 1.0;
+    for (int j = 0; j <= n; j++)
+    {
+        if (j > 0)
+        {
+            scale *= dx;
+            factorial *= j;
+        }
+        taylor[j] *= scale / factorial;
+    }
+
+    for (int k = 0; k <= n; k++)
+    {
+        double sum = 0.0;
+        for (int j = n; j >= k; j--)
+            sum += taylor[j] * surjections[j * (n + 1) + k];
+        differences[k] = sum;
+    }
+}
+
+static double propagated_drift(const double *differences, int n, size_t steps)
+{
+    double binomial = 1.0;
+    double drift = 0.0;
+
+    for (int k = 0; k <= n && (size_t)k <= steps; k++)
+    {
+        if (k > 0)
+            binomial *= (double)(steps - k + 1) / k;
+        drift += binomial * fabs(differences[k]);
+    }
+
+    return DBL_EPSILON / 2.0 * steps * drift;
+}
+
+// Number of additive steps (a power of two) before the propagated rounding error
+// of the table, about u * s * sum C(s, k) |difference_k|, exceeds the tolerance
+static size_t stable_run_length(const double *differences, int n, double tolerance, size_t limit)
+{
+    size_t run = 1;
+
+    while (run < limit && run < GRID_MAX_RUN &&
+           propagated_drift(differences, n, 2 * run) <= tolerance)
+    {
+        run *= 2;
+    }
+
+    return run < limit ? run : limit;
+}
+
+// Writes run steps of every lane to out and advances the table past them
+static void advance_differences(double *restrict differences, int n, size_t run, double *restrict out)
+{
+    for (size_t s = 0; s < run; s++)
+    {
+        for (int lane = 0; lane < GRID_LANES; lane++)
+            out[s * GRID_LANES + lane] = differences[lane];
+
+        for (int k = 0; k < n; k++)
+            for (int lane = 0; lane < GRID_LANES; lane++)
+                differences[k * GRID_LANES + lane] += differences[(k + 1) * GRID_LANES + lane];
+    }
+}
+
+void polynomial_evaluate_grid(const Polynomial *p, double x0, double dx, size_t count, double *out)
+{
+    int n = p->degree;
+
+    if (n <= 1 || count < GRID_LANES * ((size_t)n + 1))
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = polynomial_evaluate(p, x0 + i * dx);
+        return;
+    }
+
+    double *surjections = create_surjection_table(n);
+    double *taylor = allocate_or_exit((n + 1) * sizeof(double));
+    double *lane_differences = allocate_or_exit((n + 1) * sizeof(double));
+
+    // differences[k * GRID_LANES + lane]: each lane advances its own interleaved
+    // sub-grid, so the inner update is independent across lanes and vectorizes
+    double *differences = allocate_or_exit((n + 1) * GRID_LANES * sizeof(double));
+
+    size_t i = 0;
+    while (i < count)
+    {
+        size_t steps_left = (count - i) / GRID_LANES;
+        size_t run = steps_left < GRID_MAX_RUN ? steps_left : GRID_MAX_RUN;
+
+        for (int lane = 0; lane < GRID_LANES && run > 0; lane++)
+        {
+            // abscissae come from the index, so only the values can drift
+            double x = x0 + (i + lane) * dx;
+
+            init_differences(p, x, GRID_LANES * dx, surjections, taylor, lane_differences);
+
+            double tolerance = GRID_DRIFT_FACTOR * polynomial_evaluation_error_bound(p, x);
+            size_t lane_run = stable_run_length(lane_differences, n, tolerance, run);
+
+            if (lane_run < run)
+                run = lane_run;
+
+            for (int k = 0; k <= n; k++)
+                differences[k * GRID_LANES + lane] = lane_differences[k];
+        }
+
+        // a run shorter than the degree does not pay for the O(n^2) table set-up
+        if (run <= (size_t)n)
+        {
+            size_t direct = GRID_LANES * ((size_t)n + 1);
+            if (direct > count - i)
+                direct = count - i;
+
+            for (size_t s = 0; s < direct; s++)
+                out[i + s] = polynomial_evaluate(p, x0 + (i + s) * dx);
+
+            i += direct;
+            continue;
+        }
+
+        advance_differences(differences, n, run, out + i);
+
+        i += run * GRID_LANES;
+    }
+
+    free(surjections);
+    free(taylor);
+    free(lane_differences);
+    free(differences);
+}
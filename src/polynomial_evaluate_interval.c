@@ -0,0 +1,120 @@
+// polynomial_evaluate_interval.c
+#include <math.h>
+
+#include "polynomial.h"
+#include "interval.h"
+
+// Closed range [lower, upper]. Every operation rounds to nearest and then steps one
+// ulp outwards, which always contains the exact result.
+typedef struct
+{
+    double lower;
+    double upper;
+} Bounds;
+
+static Bounds round_outward(double lower, double upper)
+{
+    Bounds result = {nextafter(lower, -INFINITY), nextafter(upper, INFINITY)};
+    return result;
+}
+
+static Bounds bounds_add(Bounds a, Bounds b)
+{
+    return round_outward(a.lower + b.lower, a.upper + b.upper);
+}
+
+static Bounds bounds_multiply(Bounds a, Bounds b)
+{
+    double p1 = a.lower * b.lower;
+    double p2 = a.lower * b.upper;
+    double p3 = a.upper * b.lower;
+    double p4 = a.upper * b.upper;
+
+    return round_outward(fmin(fmin(p1, p2), fmin(p3, p4)), fmax(fmax(p1, p2), fmax(p3, p4)));
+}
+
+static Bounds bounds_point(double x)
+{
+    Bounds result = {x, x};
+    return result;
+}
+
+// Natural interval extensions of p and p' over x in one Horner pass
+static void horner_bounds(const Polynomial *p, Bounds x, Bounds *value, Bounds *derivative)
+{
+    const double *c = p->coefficients;
+
+    Bounds v = bounds_point(c[p->degree]);
+    Bounds d = bounds_point(0.0);
+
+    for (int i = p->degree - 1; i >= 0; i--)
+    {
+        d = bounds_add(bounds_multiply(d, x), v);
+        v = bounds_add(bounds_multiply(v, x), bounds_point(c[i]));
+    }
+
+    *value = v;
+    if (derivative)
+        *derivative = d;
+}
+
+// an overflow leaves nothing certain but the whole line
+static Bounds unbounded_unless_finite(Bounds b)
+{
+    if (!isfinite(b.lower) || !isfinite(b.upper))
+    {
+        Bounds whole = {-INFINITY, INFINITY};
+        return whole;
+    }
+    return b;
+}
+
+static Interval interval_from_bounds(Bounds b)
+{
+    return create_interval(extended_value_finite(b.lower), extended_value_finite(b.upper), true, true);
+}
+
+Interval polynomial_evaluate_interval(const Polynomial *p, Interval x)
+{
+    if (p->degree == 0)
+        return interval_from_bounds(bounds_point(p->coefficients[0]));
+
+    if (x.lower_bound.type != VALUE_FINITE || x.upper_bound.type != VALUE_FINITE)
+        return interval_all_real();
+
+    Bounds range = {x.lower_bound.value, x.upper_bound.value};
+
+    Bounds natural;
+    Bounds slope;
+    horner_bounds(p, range, &natural, &slope);
+
+    // mean value form p(m) + p'(x) (x - m): tighter than the natural extension on
+    // narrow intervals, where the dependency problem of Horner's scheme dominates
+    double mid = range.lower + (range.upper - range.lower) / 2.0;
+
+    Bounds at_mid;
+    horner_bounds(p, bounds_point(mid), &at_mid, NULL);
+
+    Bounds offset = round_outward(range.lower - mid, range.upper - mid);
+    Bounds centred = bounds_add(at_mid, bounds_multiply(slope, offset));
+
+    natural = unbounded_unless_finite(natural);
+    centred = unbounded_unless_finite(centred);
+
+    Bounds result = {fmax(natural.lower, centred.lower), fmin(natural.upper, centred.upper)};
+
+    if (!isfinite(result.lower) || !isfinite(result.upper))
+        return interval_all_real();
+
+    return interval_from_bounds(result);
+}
+
+bool polynomial_interval_excludes_zero(const Polynomial *p, Interval x)
+{
+    Interval enclosure = polynomial_evaluate_interval(p, x);
+
+    if (enclosure.lower_bound.type != VALUE_FINITE || enclosure.upper_bound.type != VALUE_FINITE)
+        return false;
+
+    return enclosure.lower_bound.value > 0.0 || enclosure.upper_bound.value < 0.0;
+}
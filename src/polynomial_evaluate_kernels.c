@@ -0,0 +1,89 @@
+// polynomial_evaluate_kernels.c
+#include "polynomial_kernels.h"
+
+#define POLYNOMIAL_KERNEL_DEGREES(X) \
+    X(0) X(1) X(2) X(3) X(4) X(5) X(6) X(7) \
+    X(8) X(9) X(10) X(11) X(12) X(13) X(14) X(15) \
+    X(16)
+
+#define POLYNOMIAL_DERIVATIVE_KERNEL_DEGREES(X) \
+    POLYNOMIAL_KERNEL_DEGREES(X) \
+    X(17) X(18) X(19) X(20) X(21) X(22) X(23) \
+    X(24) X(25) X(26) X(27) X(28) X(29) X(30) X(31) \
+    X(32)
+
+// HORNER_STEPS_n(STEP) expands to STEP(n - 1) STEP(n - 2) ... STEP(0)
+#define HORNER_STEPS_0(STEP)
+#define HORNER_STEPS_1(STEP) STEP(0) HORNER_STEPS_0(STEP)
+#define HORNER_STEPS_2(STEP) STEP(1) HORNER_STEPS_1(STEP)
+#define HORNER_STEPS_3(STEP) STEP(2) HORNER_STEPS_2(STEP)
+#define HORNER_STEPS_4(STEP) STEP(3) HORNER_STEPS_3(STEP)
+#define HORNER_STEPS_5(STEP) STEP(4) HORNER_STEPS_4(STEP)
+#define HORNER_STEPS_6(STEP) STEP(5) HORNER_STEPS_5(STEP)
+#define HORNER_STEPS_7(STEP) STEP(6) HORNER_STEPS_6(STEP)
+#define HORNER_STEPS_8(STEP) STEP(7) HORNER_STEPS_7(STEP)
+#define HORNER_STEPS_9(STEP) STEP(8) HORNER_STEPS_8(STEP)
+#define HORNER_STEPS_10(STEP) STEP(9) HORNER_STEPS_9(STEP)
+#define HORNER_STEPS_11(STEP) STEP(10) HORNER_STEPS_10(STEP)
+#define HORNER_STEPS_12(STEP) STEP(11) HORNER_STEPS_11(STEP)
+#define HORNER_STEPS_13(STEP) STEP(12) HORNER_STEPS_12(STEP)
+#define HORNER_STEPS_14(STEP) STEP(13) HORNER_STEPS_13(STEP)
+#define HORNER_STEPS_15(STEP) STEP(14) HORNER_STEPS_14(STEP)
+#define HORNER_STEPS_16(STEP) STEP(15) HORNER_STEPS_15(STEP)
+#define HORNER_STEPS_17(STEP) STEP(16) HORNER_STEPS_16(STEP)
+#define HORNER_STEPS_18(STEP) STEP(17) HORNER_STEPS_17(STEP)
+#define HORNER_STEPS_19(STEP) STEP(18) HORNER_STEPS_18(STEP)
+#define HORNER_STEPS_20(STEP) STEP(19) HORNER_STEPS_19(STEP)
+#define HORNER_STEPS_21(STEP) STEP(20) HORNER_STEPS_20(STEP)
+#define HORNER_STEPS_22(STEP) STEP(21) HORNER_STEPS_21(STEP)
+#define HORNER_STEPS_23(STEP) STEP(22) HORNER_STEPS_22(STEP)
+#define HORNER_STEPS_24(STEP) STEP(23) HORNER_STEPS_23(STEP)
+#define HORNER_STEPS_25(STEP) STEP(24) HORNER_STEPS_24(STEP)
+#define HORNER_STEPS_26(STEP) STEP(25) HORNER_STEPS_25(STEP)
+#define HORNER_STEPS_27(STEP) STEP(26) HORNER_STEPS_26(STEP)
+#define HORNER_STEPS_28(STEP) STEP(27) HORNER_STEPS_27(STEP)
+#define HORNER_STEPS_29(STEP) STEP(28) HORNER_STEPS_28(STEP)
+#define HORNER_STEPS_30(STEP) STEP(29) HORNER_STEPS_29(STEP)
+#define HORNER_STEPS_31(STEP) STEP(30) HORNER_STEPS_30(STEP)
+#define HORNER_STEPS_32(STEP) STEP(31) HORNER_STEPS_31(STEP)
+
+#define VALUE_STEP(i) \
+    value = HORNER_STEP(value, x, c[i]);
+
+#define VALUE_AND_DERIVATIVE_STEP(i)                \
+    derivative = HORNER_STEP(derivative, x, value); \
+    value = HORNER_STEP(value, x, c[i]);
+
+#define DEFINE_EVALUATION_KERNEL(n)                              \
+    static double evaluate_degree_##n(const double *c, double x) \
+    {                                                            \
+        (void)x;                                                 \
+        double value = c[n];                                     \
+        HORNER_STEPS_##n(VALUE_STEP)                             \
+        return value;                                            \
+    }
+
+#define DEFINE_DERIVATIVE_KERNEL(n)                                                   \
+    static void evaluate_degree_##n##_with_derivative(const double *c, double x,      \
+                                                      double *value_out,              \
+                                                      double *derivative_out)         \
+    {                                                                                 \
+        (void)x;                                                                      \
+        double value = c[n];                                                          \
+        double derivative = 0.0;                                                      \
+        HORNER_STEPS_##n(VALUE_AND_DERIVATIVE_STEP)                                   \
+        *value_out = value;                                                           \
+        *derivative_out = derivative;                                                 \
+    }
+
+POLYNOMIAL_KERNEL_DEGREES(DEFINE_EVALUATION_KERNEL)
+POLYNOMIAL_DERIVATIVE_KERNEL_DEGREES(DEFINE_DERIVATIVE_KERNEL)
+
+#define EVALUATION_KERNEL_ENTRY(n) evaluate_degree_##n,
+#define DERIVATIVE_KERNEL_ENTRY(n) evaluate_degree_##n##_with_derivative,
+
+const EvaluationKernel polynomial_evaluation_kernels[POLYNOMIAL_KERNEL_MAX_DEGREE + 1] = {
+    POLYNOMIAL_KERNEL_DEGREES(EVALUATION_KERNEL_ENTRY)};
+
+const EvaluationDerivativeKernel polynomial_derivative_kernels[POLYNOMIAL_DERIVATIVE_KERNEL_MAX_DEGREE + 1] = {
+    POLYNOMIAL_DERIVATIVE_KERNEL_DEGREES(DERIVATIVE_KERNEL_ENTRY)};
@@ -0,0 +1,370 @@
+// polynomial_evaluate_many.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+#include "polynomial.h"
+#include "polynomial_kernels.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#include <stdatomic.h>
+#endif
+
+typedef void (*EvaluateManyKernel)(const Polynomial *p, const double *xs, double *ys, size_t n);
+typedef void (*EvaluateManyFloatKernel)(const float *c, int degree, const double *xs, double *ys, size_t n);
+
+// Coefficients converted on the stack up to this degree
+#define FLOAT_STACK_DEGREE 63
+
+// Horner's scheme at every degree, the scheme the vector kernels implement; their
+// tails come here, so one call never mixes schemes
+static void evaluate_many_scalar(const Polynomial *p, const double *xs, double *ys, size_t n)
+{
+    const double *c = p->coefficients;
+
+    if (p->degree > POLYNOMIAL_KERNEL_MAX_DEGREE)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            double result = c[p->degree];
+            for (int k = p->degree - 1; k >= 0; k--)
+                result = HORNER_STEP(result, xs[i], c[k]);
+            ys[i] = result;
+        }
+        return;
+    }
+
+    EvaluationKernel kernel = polynomial_evaluation_kernels[p->degree];
+
+    for (size_t i = 0; i < n; i++)
+        ys[i] = kernel(c, xs[i]);
+}
+
+static void evaluate_many_float_scalar(const float *c, int degree, const double *xs, double *ys, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        float x = (float)xs[i];
+        float result = c[degree];
+
+        for (int k = degree - 1; k >= 0; k--)
+            result = result * x + c[k];
+
+        ys[i] = result;
+    }
+}
+
+#ifdef HAVE_X86_SIMD
+
+#ifdef __SSE2__
+static void evaluate_many_sse2(const Polynomial *p, const double *xs, double *ys, size_t n)
+{
+    const double *c = p->coefficients;
+    size_t i = 0;
+
+    // two independent Horner chains per iteration to hide the add latency
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128d x0 = _mm_loadu_pd(xs + i);
+        __m128d x1 = _mm_loadu_pd(xs + i + 2);
+
+        __m128d acc0 = _mm_set1_pd(c[p->degree]);
+        __m128d acc1 = acc0;
+
+        for (int k = p->degree - 1; k >= 0; k--)
+        {
+            __m128d ck = _mm_set1_pd(c[k]);
+            acc0 = _mm_add_pd(_mm_mul_pd(acc0, x0), ck);
+            acc1 = _mm_add_pd(_mm_mul_pd(acc1, x1), ck);
+        }
+
+        _mm_storeu_pd(ys + i, acc0);
+        _mm_storeu_pd(ys + i + 2, acc1);
+    }
+
+    evaluate_many_scalar(p, xs + i, ys + i, n - i);
+}
+#endif
+
+__attribute__((target("avx2,fma"))) static void evaluate_many_avx2(const Polynomial *p, const double *xs, double *ys, size_t n)
+{
+    const double *c = p->coefficients;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256d x0 = _mm256_loadu_pd(xs + i);
+        __m256d x1 = _mm256_loadu_pd(xs + i + 4);
+
+        __m256d acc0 = _mm256_set1_pd(c[p->degree]);
+        __m256d acc1 = acc0;
+
+        for (int k = p->degree - 1; k >= 0; k--)
+        {
+            __m256d ck = _mm256_set1_pd(c[k]);
+            acc0 = _mm256_fmadd_pd(acc0, x0, ck);
+            acc1 = _mm256_fmadd_pd(acc1, x1, ck);
+        }
+
+        _mm256_storeu_pd(ys + i, acc0);
+        _mm256_storeu_pd(ys + i + 4, acc1);
+    }
+
+    evaluate_many_scalar(p, xs + i, ys + i, n - i);
+}
+
+__attribute__((target("avx512f"))) static void evaluate_many_avx512(const Polynomial *p, const double *xs, double *ys, size_t n)
+{
+    const double *c = p->coefficients;
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m512d x0 = _mm512_loadu_pd(xs + i);
+        __m512d x1 = _mm512_loadu_pd(xs + i + 8);
+
+        __m512d acc0 = _mm512_set1_pd(c[p->degree]);
+        __m512d acc1 = acc0;
+
+        for (int k = p->degree - 1; k >= 0; k--)
+        {
+            __m512d ck = _mm512_set1_pd(c[k]);
+            acc0 = _mm512_fmadd_pd(acc0, x0, ck);
+            acc1 = _mm512_fmadd_pd(acc1, x1, ck);
+        }
+
+        _mm512_storeu_pd(ys + i, acc0);
+        _mm512_storeu_pd(ys + i + 8, acc1);
+    }
+
+    evaluate_many_scalar(p, xs + i, ys + i, n - i);
+}
+
+// float kernels: twice the lanes of the double kernels for the same register width
+
+__attribute__((target("avx2,fma"))) static void evaluate_many_float_avx2(const float *c, int degree, const double *xs, double *ys, size_t n)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m256 x0 = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(xs + i + 4)), _mm256_cvtpd_ps(_mm256_loadu_pd(xs + i)));
+        __m256 x1 = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(xs + i + 12)), _mm256_cvtpd_ps(_mm256_loadu_pd(xs + i + 8)));
+
+        __m256 acc0 = _mm256_set1_ps(c[degree]);
+        __m256 acc1 = acc0;
+
+        for (int k = degree - 1; k >= 0; k--)
+        {
+            __m256 ck = _mm256_set1_ps(c[k]);
+            acc0 = _mm256_fmadd_ps(acc0, x0, ck);
+            acc1 = _mm256_fmadd_ps(acc1, x1, ck);
+        }
+
+        _mm256_storeu_pd(ys + i, _mm256_cvtps_pd(_mm256_castps256_ps128(acc0)));
+        _mm256_storeu_pd(ys + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(acc0, 1)));
+        _mm256_storeu_pd(ys + i + 8, _mm256_cvtps_pd(_mm256_castps256_ps128(acc1)));
+        _mm256_storeu_pd(ys + i + 12, _mm256_cvtps_pd(_mm256_extractf128_ps(acc1, 1)));
+    }
+
+    evaluate_many_float_scalar(c, degree, xs + i, ys + i, n - i);
+}
+
+// 256-bit halves moved as doubles, which needs only AVX-512F
+__attribute__((target("avx512f"))) static __m512 join_float_halves(__m256 lower, __m256 upper)
+{
+    __m512d joined = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(lower)), _mm256_castps_pd(upper), 1);
+    return _mm512_castpd_ps(joined);
+}
+
+__attribute__((target("avx512f"))) static __m256 upper_float_half(__m512 v)
+{
+    return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1));
+}
+
+__attribute__((target("avx512f"))) static void evaluate_many_float_avx512(const float *c, int degree, const double *xs, double *ys, size_t n)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= n; i += 32)
+    {
+        __m512 x0 = join_float_halves(_mm512_cvtpd_ps(_mm512_loadu_pd(xs + i)), _mm512_cvtpd_ps(_mm512_loadu_pd(xs + i + 8)));
+        __m512 x1 = join_float_halves(_mm512_cvtpd_ps(_mm512_loadu_pd(xs + i + 16)), _mm512_cvtpd_ps(_mm512_loadu_pd(xs + i + 24)));
+
+        __m512 acc0 = _mm512_set1_ps(c[degree]);
+        __m512 acc1 = acc0;
+
+        for (int k = degree - 1; k >= 0; k--)
+        {
+            __m512 ck = _mm512_set1_ps(c[k]);
+            acc0 = _mm512_fmadd_ps(acc0, x0, ck);
+            acc1 = _mm512_fmadd_ps(acc1, x1, ck);
+        }
+
+        _mm512_storeu_pd(ys + i, _mm512_cvtps_pd(_mm512_castps512_ps256(acc0)));
+        _mm512_storeu_pd(ys + i + 8, _mm512_cvtps_pd(upper_float_half(acc0)));
+        _mm512_storeu_pd(ys + i + 16, _mm512_cvtps_pd(_mm512_castps512_ps256(acc1)));
+        _mm512_storeu_pd(ys + i + 24, _mm512_cvtps_pd(upper_float_half(acc1)));
+    }
+
+    evaluate_many_float_scalar(c, degree, xs + i, ys + i, n - i);
+}
+
+#endif // HAVE_X86_SIMD
+
+#ifdef HAVE_X86_SIMD
+
+static SimdLevel detect_simd_level(void)
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        return SIMD_LEVEL_AVX512;
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SIMD_LEVEL_AVX2;
+
+#ifdef __SSE2__
+    return SIMD_LEVEL_SSE2;
+#else
+    return SIMD_LEVEL_SCALAR;
+#endif
+}
+
+#endif // HAVE_X86_SIMD
+
+// The one place the CPU is probed; every kernel table dispatches on this value. The
+// cache is atomic, so threads racing on first use each store the same level without
+// a data race.
+SimdLevel polynomial_simd_level(void)
+{
+#ifdef HAVE_X86_SIMD
+    static atomic_int level = -1;
+
+    int cached = atomic_load_explicit(&level, memory_order_relaxed);
+
+    if (cached < 0)
+    {
+        cached = (int)detect_simd_level();
+        atomic_store_explicit(&level, cached, memory_order_relaxed);
+    }
+
+    return (SimdLevel)cached;
+#else
+    return SIMD_LEVEL_SCALAR;
+#endif
+}
+
+static EvaluateManyKernel kernel_for_level(SimdLevel level)
+{
+    SimdLevel supported = polynomial_simd_level();
+
+    if (level > supported)
+        level = supported;
+
+    switch (level)
+    {
+#ifdef HAVE_X86_SIMD
+    case SIMD_LEVEL_AVX512:
+        return evaluate_many_avx512;
+    case SIMD_LEVEL_AVX2:
+        return evaluate_many_avx2;
+#ifdef __SSE2__
+    case SIMD_LEVEL_SSE2:
+        return evaluate_many_sse2;
+#endif
+#endif
+    default:
+        return evaluate_many_scalar;
+    }
+}
+
+void polynomial_evaluate_many_at_level(const Polynomial *p, const double *xs, double *ys, size_t n, SimdLevel level)
+{
+    kernel_for_level(level)(p, xs, ys, n);
+}
+
+void polynomial_evaluate_many(const Polynomial *p, const double *xs, double *ys, size_t n)
+{
+    kernel_for_level(SIMD_LEVEL_AVX512)(p, xs, ys, n);
+}
+
+static EvaluateManyFloatKernel float_kernel_for_level(SimdLevel level)
+{
+    switch (level)
+    {
+#ifdef HAVE_X86_SIMD
+    case SIMD_LEVEL_AVX512:
+        return evaluate_many_float_avx512;
+    case SIMD_LEVEL_AVX2:
+        return evaluate_many_float_avx2;
+#endif
+    default:
+        return evaluate_many_float_scalar;
+    }
+}
+
+double polynomial_evaluate_many_float(const Polynomial *p, const double *xs, double *ys, size_t n)
+{
+    int degree = p->degree;
+
+    double radius = 0.0;
+    for (size_t i = 0; i < n; i++)
+        radius = fmax(radius, fabs(xs[i]));
+
+    // an absolute error of FLT_MIN at step k of Horner's scheme, from gradual underflow
+    // in the step or in rounding x, reaches the result scaled by up to radius^k
+    double scale = fmax(1.0, radius);
+
+    double magnitude = 0.0;
+    double underflow = 0.0;
+    bool subnormal = false;
+
+    for (int k = degree; k >= 0; k--)
+    {
+        double c = fabs(p->coefficients[k]);
+
+        magnitude = magnitude * radius + c;
+        underflow = underflow * scale + (2.0 + (k + 1) * c);
+        subnormal |= c != 0.0 && c < FLT_MIN;
+    }
+
+    // rounding c and x to float perturbs each term by at most (1 + u)^(k + 1) and
+    // Horner adds (1 + u)^(2n); the double evaluation of the bound gets the spare terms
+    double u = FLT_EPSILON / 2.0;
+    double gamma = (3.0 * degree + 4.0) * u / (1.0 - (3.0 * degree + 4.0) * u);
+
+    // beyond the float range stay in double, and below it too: a coefficient that is
+    // subnormal in float loses its relative accuracy when it is rounded
+    if (!(magnitude < FLT_MAX / 4.0) || !(radius < FLT_MAX / 4.0) || subnormal)
+    {
+        polynomial_evaluate_many(p, xs, ys, n);
+        return polynomial_evaluation_error_bound(p, radius);
+    }
+
+    float stack_coefficients[FLOAT_STACK_DEGREE + 1];
+    float *c = stack_coefficients;
+
+    if (degree > FLOAT_STACK_DEGREE)
+    {
+        c = malloc((degree + 1) * sizeof(float));
+        if (!c)
+        {
+            perror("malloc failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (int k = 0; k <= degree; k++)
+        c[k] = (float)p->coefficients[k];
+
+    float_kernel_for_level(polynomial_simd_level())(c, degree, xs, ys, n);
+
+    if (c != stack_coefficients)
+        free(c);
+
+    return gamma * magnitude + underflow * FLT_MIN;
+}
@@ -0,0 +1,395 @@
+// polynomial_gcd.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "polynomial.h"
+#include "mod_polynomial.h"
+
+// Remainder coefficients below this fraction of the divisor's largest one count as
+// rounding noise in the floating point Euclidean algorithm
+#define GCD_RELATIVE_TOLERANCE 1e-9
+
+// Every integer up to 2^53 in magnitude is a double
+#define EXACT_INTEGER_LIMIT 9007199254740992.0
+
+// Coefficient buffers below are zero when their degree is -1
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+static double max_norm(const double *c, int degree)
+{
+    double norm = 0.0;
+    for (int i = 0; i <= degree; i++)
+        norm = fmax(norm, fabs(c[i]));
+    return norm;
+}
+
+static int nonzero_degree(const double *c, int degree, double tolerance)
+{
+    while (degree >= 0 && fabs(c[degree]) <= tolerance)
+        degree--;
+    return degree;
+}
+
+static double integer_gcd(double a, double b)
+{
+    a = fabs(a);
+    b = fabs(b);
+
+    while (b != 0.0)
+    {
+        double r = fmod(a, b);
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+// divides out the integer content and makes the leading coefficient positive
+static void make_primitive(double *c, int degree)
+{
+    double content = 0.0;
+    for (int i = 0; i <= degree && content != 1.0; i++)
+        content = integer_gcd(content, c[i]);
+
+    if (c[degree] < 0)
+        content = -content;
+
+    for (int i = 0; i <= degree; i++)
+        c[i] /= content;
+}
+
+static void make_monic(double *c, int degree)
+{
+    double lead = c[degree];
+    for (int i = 0; i <= degree; i++)
+        c[i] /= lead;
+}
+
+// u = lc(v)^k u mod v over the integers, in place. Returns the remainder's degree,
+// or -2 when a product could leave the exactly representable integers.
+static int pseudo_remainder(double *u, int u_degree, const double *v, int v_degree)
+{
+    double v_lead = v[v_degree];
+    double v_norm = max_norm(v, v_degree);
+
+    while (u_degree >= v_degree)
+    {
+        double u_lead = u[u_degree];
+
+        if (fabs(v_lead) * max_norm(u, u_degree) + fabs(u_lead) * v_norm >= EXACT_INTEGER_LIMIT)
+            return -2;
+
+        int shift = u_degree - v_degree;
+
+        for (int i = 0; i < shift; i++)
+            u[i] *= v_lead;
+        for (int j = 0; j < v_degree; j++)
+            u[shift + j] = v_lead * u[shift + j] - u_lead * v[j];
+
+        u_degree = nonzero_degree(u, u_degree - 1, 0.0);
+    }
+
+    return u_degree;
+}
+
+// Primitive remainder sequence: pseudo-division keeps every value an integer and
+// dividing out the content after each step keeps them small. u_degree >= v_degree
+// >= 0; both buffers are overwritten. Writes the primitive gcd to gcd and returns its
+// degree, or -1 when the coefficients grow past 2^53.
+static int integer_gcd_coefficients(double *u, int u_degree, double *v, int v_degree, double *gcd)
+{
+    make_primitive(u, u_degree);
+    make_primitive(v, v_degree);
+
+    for (;;)
+    {
+        int r_degree = pseudo_remainder(u, u_degree, v, v_degree);
+
+        if (r_degree == -2)
+            return -1;
+
+        if (r_degree == -1)
+        {
+            memcpy(gcd, v, (v_degree + 1) * sizeof(double));
+            return v_degree;
+        }
+
+        make_primitive(u, r_degree);
+
+        double *swap = u;
+        u = v;
+        v = swap;
+
+        u_degree = v_degree;
+        v_degree = r_degree;
+    }
+}
+
+// Euclid's algorithm with every remainder scaled to max norm 1, so the cut-off for
+// rounding noise is relative rather than absolute. u_degree >= v_degree >= 0; both
+// buffers are overwritten. Writes the monic gcd to gcd and returns its degree.
+static int float_gcd_coefficients(double *u, int u_degree, double *v, int v_degree, double *gcd)
+{
+    for (;;)
+    {
+        double v_lead = v[v_degree];
+        double v_norm = max_norm(v, v_degree);
+
+        for (int i = 0; i <= v_degree; i++)
+            v[i] /= v_norm;
+        v_lead /= v_norm;
+
+        // the rounding noise left in the remainder grows with the largest quotient term
+        double scale = 1.0;
+
+        for (int shift = u_degree - v_degree; shift >= 0; shift--)
+        {
+            double q = u[shift + v_degree] / v_lead;
+            scale = fmax(scale, fabs(q));
+
+            for (int j = 0; j < v_degree; j++)
+                u[shift + j] -= q * v[j];
+        }
+
+        int r_degree = nonzero_degree(u, v_degree - 1, GCD_RELATIVE_TOLERANCE * scale);
+
+        if (r_degree == -1)
+        {
+            memcpy(gcd, v, (v_degree + 1) * sizeof(double));
+            make_monic(gcd, v_degree);
+            return v_degree;
+        }
+
+        double *swap = u;
+        u = v;
+        v = swap;
+
+        u_degree = v_degree;
+        v_degree = r_degree;
+    }
+}
+
+Polynomial polynomial_gcd(const Polynomial *p1, const Polynomial *p2)
+{
+    int p1_degree = nonzero_degree(p1->coefficients, p1->degree, 0.0);
+    int p2_degree = nonzero_degree(p2->coefficients, p2->degree, 0.0);
+
+    if (p1_degree < 0 && p2_degree < 0)
+        return create_zero_polynomial();
+
+    // u is the operand of higher degree
+    const Polynomial *high = (p1_degree >= p2_degree) ? p1 : p2;
+    const Polynomial *low = (p1_degree >= p2_degree) ? p2 : p1;
+    int u_degree = (p1_degree >= p2_degree) ? p1_degree : p2_degree;
+    int v_degree = (p1_degree >= p2_degree) ? p2_degree : p1_degree;
+
+    double *u = allocate_or_exit((u_degree + 1) * sizeof(double));
+    double *v = allocate_or_exit((u_degree + 1) * sizeof(double));
+    double *gcd = allocate_or_exit((u_degree + 1) * sizeof(double));
+
+    bool integer = polynomial_is_integer(p1) && polynomial_is_integer(p2);
+    int degree = -1;
+
+    if (v_degree < 0)
+    {
+        // gcd(u, 0) = u, normalised like any other result
+        memcpy(gcd, high->coefficients, (u_degree + 1) * sizeof(double));
+        degree = u_degree;
+
+        if (integer)
+            make_primitive(gcd, degree);
+        else
+            make_monic(gcd, degree);
+    }
+    else
+    {
+        if (integer)
+        {
+            memcpy(u, high->coefficients, (u_degree + 1) * sizeof(double));
+            memcpy(v, low->coefficients, (v_degree + 1) * sizeof(double));
+            degree = integer_gcd_coefficients(u, u_degree, v, v_degree, gcd);
+        }
+
+        if (degree < 0)
+        {
+            memcpy(u, high->coefficients, (u_degree + 1) * sizeof(double));
+            memcpy(v, low->coefficients, (v_degree + 1) * sizeof(double));
+
+            // u at max norm 1 as well, so both operands start on the same scale
+            double u_norm = max_norm(u, u_degree);
+            for (int i = 0; i <= u_degree; i++)
+                u[i] /= u_norm;
+
+            degree = float_gcd_coefficients(u, u_degree, v, v_degree, gcd);
+        }
+    }
+
+    Polynomial result = create_polynomial(gcd, degree);
+
+    free(u);
+    free(v);
+    free(gcd);
+
+    return result;
+}
+
+// p / d for a d known to divide p; integer quotients are rounded back onto the
+// integers they stand for
+static Polynomial exact_quotient(const Polynomial *p, const Polynomial *d, bool integer)
+{
+    Polynomial rest;
+    Polynomial quotient = polynomial_divide(p, d, &rest);
+    free_polynomial(&rest);
+
+    if (integer)
+        for (int i = 0; i <= quotient.degree; i++)
+            quotient.coefficients[i] = round(quotient.coefficients[i]);
+
+    return quotient;
+}
+
+static void add_factor(SquareFreeDecomposition *d, Polynomial factor, int multiplicity)
+{
+    d->factors = realloc(d->factors, (d->count + 1) * sizeof(SquareFreeFactor));
+    if (!d->factors)
+    {
+        perror("realloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    d->factors[d->count].factor = factor;
+    d->factors[d->count].multiplicity = multiplicity;
+    d->count++;
+}
+
+// Primes tried before the modular test gives up
+#define SQUARE_FREE_TEST_PRIMES 2
+
+// An integer p is square-free when gcd(p, p') is constant modulo a prime that keeps
+// its degree: a repeated factor keeps its degree too and divides both. A prime
+// dividing the discriminant makes the gcd nontrivial anyway, so false proves nothing.
+static bool is_square_free_modular(const Polynomial *p)
+{
+    for (int i = 0; i < SQUARE_FREE_TEST_PRIMES; i++)
+    {
+        ModPolynomial reduced = mod_polynomial_from_polynomial(p, mod_polynomial_primes[i]);
+
+        bool square_free = false;
+
+        if (reduced.degree == p->degree)
+        {
+            ModPolynomial derivative = mod_polynomial_derivative(&reduced);
+            ModPolynomial g = mod_polynomial_gcd(&reduced, &derivative);
+
+            square_free = g.degree == 0;
+
+            free_mod_polynomial(&derivative);
+            free_mod_polynomial(&g);
+        }
+
+        free_mod_polynomial(&reduced);
+
+        if (square_free)
+            return true;
+    }
+
+    return false;
+}
+
+// Yun's algorithm: with b = p / gcd(p, p') and c = p' / gcd(p, p'), each gcd(b, c - b')
+// is the product of the factors of the next multiplicity. Integer inputs stay
+// integral throughout by Gauss's lemma, so their factors are exact.
+SquareFreeDecomposition polynomial_square_free_decomposition(const Polynomial *p)
+{
+    SquareFreeDecomposition d = {.factors = NULL, .count = 0};
+
+    if (p->degree < 1)
+        return d;
+
+    bool integer = polynomial_is_integer(p);
+
+    // the common case settled by word-size arithmetic, before any gcd over Z or R
+    if (integer && is_square_free_modular(p))
+    {
+        add_factor(&d, copy_polynomial(p), 1);
+        return d;
+    }
+
+    Polynomial derivative = polynomial_derivative(p);
+    Polynomial g = polynomial_gcd(p, &derivative);
+
+    Polynomial b = exact_quotient(p, &g, integer);
+    Polynomial c = exact_quotient(&derivative, &g, integer);
+
+    free_polynomial(&derivative);
+    free_polynomial(&g);
+
+    // no multiplicity exceeds the degree, which bounds the loop when rounding keeps a
+    // floating point gcd from ever reaching b
+    int multiplicity = 1;
+
+    for (; b.degree > 0 && multiplicity <= p->degree; multiplicity++)
+    {
+        Polynomial b_derivative = polynomial_derivative(&b);
+        Polynomial e = polynomial_subtract(&c, &b_derivative);
+
+        // c - b' vanishes once b holds the last factor; in floating point only up to
+        // the rounding of the cancellation
+        if (!integer && max_norm(e.coefficients, e.degree) <=
+                            GCD_RELATIVE_TOLERANCE * max_norm(c.coefficients, c.degree))
+        {
+            free_polynomial(&e);
+            e = create_zero_polynomial();
+        }
+
+        Polynomial factor = polynomial_gcd(&b, &e);
+
+        free_polynomial(&b_derivative);
+        free_polynomial(&c);
+
+        Polynomial next_b = exact_quotient(&b, &factor, integer);
+        c = exact_quotient(&e, &factor, integer);
+
+        free_polynomial(&b);
+        free_polynomial(&e);
+        b = next_b;
+
+        if (factor.degree > 0)
+            add_factor(&d, factor, multiplicity);
+        else
+            free_polynomial(&factor);
+    }
+
+    // whatever the loop could not split keeps its roots, as simple ones
+    if (b.degree > 0)
+        add_factor(&d, b, 1);
+    else
+        free_polynomial(&b);
+
+    free_polynomial(&c);
+
+    return d;
+}
+
+void free_square_free_decomposition(SquareFreeDecomposition *d)
+{
+    for (int i = 0; i < d->count; i++)
+        free_polynomial(&d->factors[i].factor);
+
+    free(d->factors);
+    d->factors = NULL;
+    d->count = 0;
+}
@@ -10,6 +10,7 @@
 #include "interval.h"
 #include "point.h"
 #include "int_array_list.h"
+#include "mod_polynomial.h"
 
 static void add_roots(Polynomial *p, RootArrayList roots)
 {
@@ -25,7 +26,10 @@ static void slice_intervals_untill_contain_one_root(const SturmSequence *sequenc
 
     Interval left_interval = create_interval(interval.lower_bound, (ExtendedValue){VALUE_FINITE, mid_point}, interval.lower_inclusive, false);
 
-    int realRootsInLeft = sturm_sequence_count_real_roots_in_interval(sequence, left_interval);
+    // a root-free enclosure settles the count without evaluating the whole chain
+    int realRootsInLeft = polynomial_interval_excludes_zero(&sequence->polynomials[0], left_interval)
+                              ? 0
+                              : sturm_sequence_count_real_roots_in_interval(sequence, left_interval);
 
     if ((left_interval.upper_bound.value - left_interval.lower_bound.value) > 0.125 && realRootsInLeft > 1)
         slice_intervals_untill_contain_one_root(sequence, left_interval, interval_list);
@@ -34,7 +38,9 @@ static void slice_intervals_untill_contain_one_root(const SturmSequence *sequenc
 
     Interval right_interval = create_interval((ExtendedValue){VALUE_FINITE, mid_point}, interval.upper_bound, false, interval.upper_inclusive);
 
-    int realRootsInRight = sturm_sequence_count_real_roots_in_interval(sequence, right_interval);
+    int realRootsInRight = polynomial_interval_excludes_zero(&sequence->polynomials[0], right_interval)
+                               ? 0
+                               : sturm_sequence_count_real_roots_in_interval(sequence, right_interval);
 
     if ((right_interval.upper_bound.value - right_interval.lower_bound.value) > 0.125 && realRootsInRight > 1)
         slice_intervals_untill_contain_one_root(sequence, right_interval, interval_list);
@@ -118,6 +124,31 @@ static void find_quadratic_roots(Polynomial *p)
     root_array_list_sort(&p->roots);
 }
 
+// Tests p(numerator / denominator) == 0 on the integer form
+// sum a_i numerator^i denominator^(n - i), so the quotient is never rounded.
+static bool is_rational_root(const Polynomial *p, double numerator, double denominator)
+{
+    double *scaled = malloc((p->degree + 1) * sizeof(double));
+    if (!scaled)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    double scale = 1.0;
+    for (int i = p->degree; i >= 0; i--)
+    {
+        scaled[i] = p->coefficients[i] * scale;
+        scale *= denominator;
+    }
+
+    Polynomial homogeneous = {.degree = p->degree, .coefficients = scaled};
+    bool is_root = polynomial_sign_at(&homogeneous, numerator) == 0;
+
+    free(scaled);
+    return is_root;
+}
+
 static void find_integer_roots_of_integer_polynomial(Polynomial *p)
 {
     IntArrayList constant_term_divisors, leading_coefficient_divisors;
@@ -128,9 +159,27 @@ static void find_integer_roots_of_integer_polynomial(Polynomial *p)
     get_divisors(&constant_term_divisors, p->coefficients[0]);
     get_divisors(&leading_coefficient_divisors, p->coefficients[p->degree]);
 
+    // p(c / l) = 0 makes the integer sum a_i c^i l^(n - i) vanish, so modulo a prime as
+    // well: with l invertible there, p(c l^-1) != 0 rejects the candidate in a few
+    // word operations. The divisors are far below the prime, and a non-root passes
+    // only with probability about degree / prime.
+    uint64_t prime = mod_polynomial_primes[0];
+    ModPolynomial residue = mod_polynomial_from_polynomial(p, prime);
+
+    uint64_t *inverses = malloc(leading_coefficient_divisors.size * sizeof(uint64_t));
+    if (!inverses)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int j = 0; j < leading_coefficient_divisors.size; j++)
+        inverses[j] = mod_inverse(mod_from_double(leading_coefficient_divisors.values[j], prime), prime);
+
     for (int i = 0; i < constant_term_divisors.size; i++)
     {
         double c = constant_term_divisors.values[i];
+        uint64_t c_residue = mod_from_double(c, prime);
 
         for (int j = 0; j < leading_coefficient_divisors.size; j++)
         {
@@ -138,10 +187,12 @@ static void find_integer_roots_of_integer_polynomial(Polynomial *p)
 
             double possible_root = c / l;
 
-            if (polynomial_evaluate(p, possible_root) == 0)
+            uint64_t x = mod_multiply(c_residue, inverses[j], prime);
+
+            if (mod_polynomial_evaluate(&residue, x) == 0 && is_rational_root(p, c, l))
                 root_array_list_add(&p->roots, create_root(possible_root, 1));
 
-            if (polynomial_evaluate(p, -possible_root) == 0)
+            if (mod_polynomial_evaluate(&residue, prime - x) == 0 && is_rational_root(p, -c, l))
                 root_array_list_add(&p->roots, create_root(-possible_root, 1));
         }
     }
@@ -149,35 +200,51 @@ static void find_integer_roots_of_integer_polynomial(Polynomial *p)
     free_int_array_list(&constant_term_divisors);
     free_int_array_list(&leading_coefficient_divisors);
 
+    free_mod_polynomial(&residue);
+    free(inverses);
+
     root_array_list_sort(&p->roots);
 }
 
-static void find_irrational_roots(Polynomial *p, const Polynomial *derivative)
+// Roots are isolated on the square-free factors, whose Sturm chains are shorter and
+// never end early, and where Newton's method converges quadratically; each factor
+// carries the multiplicity of its roots.
+static void find_irrational_roots(Polynomial *p)
 {
-    SturmSequence sequence = create_sturm_sequence(p);
-
-    IntervalArrayList values = find_root_intervals(&sequence);
+    SquareFreeDecomposition decomposition = polynomial_square_free_decomposition(p);
 
-    for (int i = 0; i < values.size; i++)
+    for (int f = 0; f < decomposition.count; f++)
     {
-        Interval interval = values.values[i];
+        const Polynomial *factor = &decomposition.factors[f].factor;
+
+        SturmSequence sequence = create_sturm_sequence(factor);
+
+        IntervalArrayList values = find_root_intervals(&sequence);
 
-        int multiplicity = sturm_sequence_count_real_roots_in_interval(&sequence, interval);
+        for (int i = 0; i < values.size; i++)
+        {
+            Interval interval = values.values[i];
+
+            // more than one only for distinct roots closer than the isolation width
+            int count = sturm_sequence_count_real_roots_in_interval(&sequence, interval);
 
-        double mid_point = (interval.lower_bound.value + interval.upper_bound.value) / 2.0;
+            double mid_point = (interval.lower_bound.value + interval.upper_bound.value) / 2.0;
 
-        double root_approx = newton_raphson_polynomial(p, derivative, mid_point, 1e-7, 100);
+            double root_approx = newton_raphson_polynomial(factor, mid_point, 1e-7, 100);
+
+            root_array_list_add(&p->roots, create_root(root_approx, count * decomposition.factors[f].multiplicity));
+        }
 
-        root_array_list_add(&p->roots, create_root(root_approx, multiplicity));
+        free_sturm_sequence(&sequence);
+        free_interval_array_list(&values);
     }
 
     root_array_list_sort(&p->roots);
 
-    free_sturm_sequence(&sequence);
-    free_interval_array_list(&values);
+    free_square_free_decomposition(&decomposition);
 }
 
-static void find_roots(Polynomial *p, const Polynomial *derivative)
+static void find_roots(Polynomial *p)
 {
     if (p->degree == 0)
         return;
@@ -200,15 +267,10 @@ static void find_roots(Polynomial *p, const Polynomial *derivative)
     {
         root_array_list_add(&p->roots, create_root(0.0, 1));
 
-        Polynomial polynomial_to_devide = create_polynomial((double[]){0, 1}, 1);
+        Polynomial reduced = copy_polynomial(p);
+        polynomial_deflate_linear(&reduced, 0.0, DEFLATION_FORWARD);
 
-        Polynomial reduced = polynomial_divide(p, &polynomial_to_devide, NULL);
-        Polynomial reduced_derivative = polynomial_derivative(&reduced);
-
-        free_polynomial(&polynomial_to_devide);
-        find_roots(&reduced, &reduced_derivative);
-
-        free_polynomial(&reduced_derivative);
+        find_roots(&reduced);
 
         add_roots(p, reduced.roots);
 
@@ -228,22 +290,9 @@ static void find_roots(Polynomial *p, const Polynomial *derivative)
             Polynomial reduced = copy_polynomial(p);
 
             for (int i = 0; i < p->roots.size; i++)
-            {
-                double coef = -p->roots.values[i].value;
-
-                Polynomial binomial = create_binomial(1, coef);
-
-                Polynomial result = polynomial_divide(&reduced, &binomial, NULL);
-
-                free_polynomial(&reduced);
-                free_polynomial(&binomial);
-
-                reduced = result;
-            }
+                polynomial_deflate_linear(&reduced, p->roots.values[i].value, DEFLATION_AUTO);
 
-            Polynomial reduced_derivative = polynomial_derivative(&reduced);
-            find_roots(&reduced, &reduced_derivative);
-            free_polynomial(&reduced_derivative);
+            find_roots(&reduced);
 
             if (reduced.roots.size > 0)
             {
@@ -258,7 +307,7 @@ static void find_roots(Polynomial *p, const Polynomial *derivative)
         }
     }
 
-    find_irrational_roots(p, derivative);
+    find_irrational_roots(p);
 }
 
 static void find_extreme_points(Polynomial *p, const Polynomial *first_derivative)
@@ -478,12 +527,11 @@ void polynomial_find_properties(Polynomial *p)
 
     Polynomial derivative = polynomial_derivative(p);
     Polynomial second_derivative = polynomial_derivative(&derivative);
-    Polynomial third_derivative = polynomial_derivative(&second_derivative);
 
-    find_roots(&derivative, &second_derivative);
-    find_roots(&second_derivative, &third_derivative);
+    find_roots(&derivative);
+    find_roots(&second_derivative);
 
-    find_roots(p, &derivative);
+    find_roots(p);
     find_extreme_points(p, &derivative);
     find_positive_negative_intervals(p);
     find_monotonic_intervals(p);
@@ -493,5 +541,4 @@ void polynomial_find_properties(Polynomial *p)
 
     free_polynomial(&derivative);
     free_polynomial(&second_derivative);
-    free_polynomial(&third_derivative);
 }
\ No newline at end of file
@@ -0,0 +1,179 @@
+// rational.c
+#include <stddef.h>
+#include <math.h>
+
+#include "rational.h"
+
+Rational create_rational(BigInteger numerator, BigInteger denominator)
+{
+    if (denominator.sign < 0)
+    {
+        numerator.sign = -numerator.sign;
+        denominator.sign = 1;
+    }
+
+    if (numerator.sign == 0)
+    {
+        free_big_integer(&numerator);
+        free_big_integer(&denominator);
+        return rational_from_integer(0);
+    }
+
+    if (big_integer_is_one(&denominator))
+        return (Rational){.numerator = numerator, .denominator = denominator};
+
+    BigInteger divisor = big_integer_gcd(&numerator, &denominator);
+
+    if (big_integer_is_one(&divisor))
+    {
+        free_big_integer(&divisor);
+        return (Rational){.numerator = numerator, .denominator = denominator};
+    }
+
+    Rational result;
+    big_integer_divide(&numerator, &divisor, &result.numerator, NULL);
+    big_integer_divide(&denominator, &divisor, &result.denominator, NULL);
+
+    free_big_integer(&numerator);
+    free_big_integer(&denominator);
+    free_big_integer(&divisor);
+
+    return result;
+}
+
+Rational rational_from_integer(long long value)
+{
+    return (Rational){.numerator = big_integer_from_int64(value), .denominator = big_integer_from_int64(1)};
+}
+
+Rational rational_from_double(double value)
+{
+    int exponent;
+    double fraction = frexp(value, &exponent);
+
+    // value = mantissa 2^(exponent - 53) with an integer mantissa
+    BigInteger mantissa = big_integer_from_double(ldexp(fraction, 53));
+    BigInteger one = big_integer_from_int64(1);
+
+    if (exponent >= 53)
+    {
+        BigInteger numerator = big_integer_shift_left(&mantissa, exponent - 53);
+        free_big_integer(&mantissa);
+        return (Rational){.numerator = numerator, .denominator = one};
+    }
+
+    BigInteger denominator = big_integer_shift_left(&one, 53 - exponent);
+    free_big_integer(&one);
+
+    return create_rational(mantissa, denominator);
+}
+
+Rational copy_rational(const Rational *a)
+{
+    return (Rational){.numerator = copy_big_integer(&a->numerator), .denominator = copy_big_integer(&a->denominator)};
+}
+
+void free_rational(Rational *a)
+{
+    free_big_integer(&a->numerator);
+    free_big_integer(&a->denominator);
+}
+
+// a / b + sign c / d over a common denominator; integers skip the cross products
+static Rational add_signed(const Rational *a, const Rational *b, int sign)
+{
+    BigInteger numerator;
+
+    if (big_integer_is_one(&a->denominator) && big_integer_is_one(&b->denominator))
+    {
+        numerator = (sign > 0) ? big_integer_add(&a->numerator, &b->numerator)
+                               : big_integer_subtract(&a->numerator, &b->numerator);
+
+        return (Rational){.numerator = numerator, .denominator = big_integer_from_int64(1)};
+    }
+
+    BigInteger ad = big_integer_multiply(&a->numerator, &b->denominator);
+    BigInteger cb = big_integer_multiply(&b->numerator, &a->denominator);
+
+    numerator = (sign > 0) ? big_integer_add(&ad, &cb) : big_integer_subtract(&ad, &cb);
+
+    free_big_integer(&ad);
+    free_big_integer(&cb);
+
+    return create_rational(numerator, big_integer_multiply(&a->denominator, &b->denominator));
+}
+
+Rational rational_add(const Rational *a, const Rational *b)
+{
+    return add_signed(a, b, 1);
+}
+
+Rational rational_subtract(const Rational *a, const Rational *b)
+{
+    return add_signed(a, b, -1);
+}
+
+Rational rational_multiply(const Rational *a, const Rational *b)
+{
+    return create_rational(big_integer_multiply(&a->numerator, &b->numerator),
+                           big_integer_multiply(&a->denominator, &b->denominator));
+}
+
+Rational rational_divide(const Rational *a, const Rational *b)
+{
+    return create_rational(big_integer_multiply(&a->numerator, &b->denominator),
+                           big_integer_multiply(&a->denominator, &b->numerator));
+}
+
+Rational rational_negate(const Rational *a)
+{
+    Rational result = copy_rational(a);
+    result.numerator.sign = -result.numerator.sign;
+    return result;
+}
+
+int rational_sign(const Rational *a)
+{
+    return a->numerator.sign;
+}
+
+int rational_compare(const Rational *a, const Rational *b)
+{
+    Rational difference = rational_subtract(a, b);
+    int sign = rational_sign(&difference);
+    free_rational(&difference);
+
+    return sign;
+}
+
+bool rational_is_zero(const Rational *a)
+{
+    return a->numerator.sign == 0;
+}
+
+bool rational_is_integer(const Rational *a)
+{
+    return big_integer_is_one(&a->denominator);
+}
+
+double rational_to_double(const Rational *a)
+{
+    if (big_integer_is_one(&a->denominator))
+        return big_integer_to_double(&a->numerator);
+
+    // a quotient of at least 64 bits keeps the truncated division below half an ulp
+    int shift = 64 + big_integer_bit_length(&a->denominator) - big_integer_bit_length(&a->numerator);
+    if (shift < 0)
+        shift = 0;
+
+    BigInteger scaled = big_integer_shift_left(&a->numerator, shift);
+    BigInteger quotient;
+    big_integer_divide(&scaled, &a->denominator, &quotient, NULL);
+
+    double value = ldexp(big_integer_to_double(&quotient), -shift);
+
+    free_big_integer(&scaled);
+    free_big_integer(&quotient);
+
+    return value;
+}
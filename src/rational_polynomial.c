@@ -0,0 +1,651 @@
+// rational_polynomial.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "rational_polynomial.h"
+#include "uint128.h"
+
+static void *allocate_or_exit(size_t size)
+{
+    void *memory = malloc(size);
+    if (!memory)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+// room for degree + 1 coefficients, all zero
+static RationalPolynomial create_zero_rational_polynomial(int degree)
+{
+    RationalPolynomial p = {.degree = degree};
+    p.coefficients = allocate_or_exit((degree + 1) * sizeof(Rational));
+
+    for (int i = 0; i <= degree; i++)
+        p.coefficients[i] = rational_from_integer(0);
+
+    return p;
+}
+
+// drops zero leading coefficients, keeping the allocation
+static void trim_degree(RationalPolynomial *p)
+{
+    while (p->degree > 0 && rational_is_zero(&p->coefficients[p->degree]))
+    {
+        free_rational(&p->coefficients[p->degree]);
+        p->degree--;
+    }
+}
+
+RationalPolynomial create_rational_polynomial(const Rational *coefficients, int degree)
+{
+    RationalPolynomial p = {.degree = degree};
+    p.coefficients = allocate_or_exit((degree + 1) * sizeof(Rational));
+
+    for (int i = 0; i <= degree; i++)
+        p.coefficients[i] = copy_rational(&coefficients[i]);
+
+    trim_degree(&p);
+    return p;
+}
+
+RationalPolynomial rational_polynomial_from_polynomial(const Polynomial *p)
+{
+    RationalPolynomial result = {.degree = p->degree};
+    result.coefficients = allocate_or_exit((p->degree + 1) * sizeof(Rational));
+
+    for (int i = 0; i <= p->degree; i++)
+        result.coefficients[i] = rational_from_double(p->coefficients[i]);
+
+    trim_degree(&result);
+    return result;
+}
+
+Polynomial rational_polynomial_to_polynomial(const RationalPolynomial *p)
+{
+    double *coefficients = allocate_or_exit((p->degree + 1) * sizeof(double));
+
+    for (int i = 0; i <= p->degree; i++)
+        coefficients[i] = rational_to_double(&p->coefficients[i]);
+
+    Polynomial result = create_polynomial(coefficients, p->degree);
+    free(coefficients);
+
+    return result;
+}
+
+RationalPolynomial copy_rational_polynomial(const RationalPolynomial *p)
+{
+    return create_rational_polynomial(p->coefficients, p->degree);
+}
+
+void free_rational_polynomial(RationalPolynomial *p)
+{
+    for (int i = 0; i <= p->degree; i++)
+        free_rational(&p->coefficients[i]);
+
+    free(p->coefficients);
+    p->coefficients = NULL;
+    p->degree = 0;
+}
+
+static RationalPolynomial add_signed(const RationalPolynomial *p1, const RationalPolynomial *p2, int sign)
+{
+    int degree = (p1->degree > p2->degree) ? p1->degree : p2->degree;
+
+    RationalPolynomial result = {.degree = degree};
+    result.coefficients = allocate_or_exit((degree + 1) * sizeof(Rational));
+
+    for (int i = 0; i <= degree; i++)
+    {
+        if (i > p2->degree)
+            result.coefficients[i] = copy_rational(&p1->coefficients[i]);
+        else if (i > p1->degree)
+            result.coefficients[i] = (sign > 0) ? copy_rational(&p2->coefficients[i])
+                                                : rational_negate(&p2->coefficients[i]);
+        else
+            result.coefficients[i] = (sign > 0) ? rational_add(&p1->coefficients[i], &p2->coefficients[i])
+                                                : rational_subtract(&p1->coefficients[i], &p2->coefficients[i]);
+    }
+
+    trim_degree(&result);
+    return result;
+}
+
+RationalPolynomial rational_polynomial_add(const RationalPolynomial *p1, const RationalPolynomial *p2)
+{
+    return add_signed(p1, p2, 1);
+}
+
+RationalPolynomial rational_polynomial_subtract(const RationalPolynomial *p1, const RationalPolynomial *p2)
+{
+    return add_signed(p1, p2, -1);
+}
+
+RationalPolynomial rational_polynomial_multiply(const RationalPolynomial *p1, const RationalPolynomial *p2)
+{
+    RationalPolynomial result = create_zero_rational_polynomial(p1->degree + p2->degree);
+
+    for (int i = 0; i <= p1->degree; i++)
+    {
+        if (rational_is_zero(&p1->coefficients[i]))
+            continue;
+
+        for (int j = 0; j <= p2->degree; j++)
+        {
+            Rational product = rational_multiply(&p1->coefficients[i], &p2->coefficients[j]);
+            Rational sum = rational_add(&result.coefficients[i + j], &product);
+
+            free_rational(&product);
+            free_rational(&result.coefficients[i + j]);
+            result.coefficients[i + j] = sum;
+        }
+    }
+
+    trim_degree(&result);
+    return result;
+}
+
+RationalPolynomial rational_polynomial_derivative(const RationalPolynomial *p)
+{
+    if (p->degree == 0)
+        return create_zero_rational_polynomial(0);
+
+    RationalPolynomial result = {.degree = p->degree - 1};
+    result.coefficients = allocate_or_exit(p->degree * sizeof(Rational));
+
+    for (int i = 1; i <= p->degree; i++)
+    {
+        Rational power = rational_from_integer(i);
+        result.coefficients[i - 1] = rational_multiply(&p->coefficients[i], &power);
+        free_rational(&power);
+    }
+
+    trim_degree(&result);
+    return result;
+}
+
+RationalPolynomial rational_polynomial_divide(const RationalPolynomial *p1, const RationalPolynomial *p2,
+                                              RationalPolynomial *rest)
+{
+    int m = p2->degree;
+
+    if (p1->degree < m)
+    {
+        *rest = copy_rational_polynomial(p1);
+        return create_zero_rational_polynomial(0);
+    }
+
+    RationalPolynomial remainder = copy_rational_polynomial(p1);
+    RationalPolynomial quotient = create_zero_rational_polynomial(p1->degree - m);
+
+    const Rational *lead = &p2->coefficients[m];
+
+    for (int shift = p1->degree - m; shift >= 0; shift--)
+    {
+        Rational *top = &remainder.coefficients[shift + m];
+
+        if (rational_is_zero(top))
+            continue;
+
+        Rational q = rational_divide(top, lead);
+
+        for (int j = 0; j < m; j++)
+        {
+            if (rational_is_zero(&p2->coefficients[j]))
+                continue;
+
+            Rational product = rational_multiply(&q, &p2->coefficients[j]);
+            Rational difference = rational_subtract(&remainder.coefficients[shift + j], &product);
+
+            free_rational(&product);
+            free_rational(&remainder.coefficients[shift + j]);
+            remainder.coefficients[shift + j] = difference;
+        }
+
+        free_rational(top);
+        *top = rational_from_integer(0);
+
+        free_rational(&quotient.coefficients[shift]);
+        quotient.coefficients[shift] = q;
+    }
+
+    // the remainder is below the divisor's degree; its leading slots are all zero
+    trim_degree(&remainder);
+    trim_degree(&quotient);
+
+    *rest = remainder;
+    return quotient;
+}
+
+RationalPolynomial rational_polynomial_primitive_part(const RationalPolynomial *p)
+{
+    // lcm of the denominators clears them, the gcd of the numerators then comes out
+    BigInteger multiple = big_integer_from_int64(1);
+
+    for (int i = 0; i <= p->degree; i++)
+    {
+        const BigInteger *denominator = &p->coefficients[i].denominator;
+
+        if (big_integer_is_one(denominator))
+            continue;
+
+        BigInteger divisor = big_integer_gcd(&multiple, denominator);
+        BigInteger factor;
+        big_integer_divide(denominator, &divisor, &factor, NULL);
+
+        BigInteger lcm = big_integer_multiply(&multiple, &factor);
+
+        free_big_integer(&multiple);
+        free_big_integer(&divisor);
+        free_big_integer(&factor);
+        multiple = lcm;
+    }
+
+    BigInteger *numerators = allocate_or_exit((p->degree + 1) * sizeof(BigInteger));
+    BigInteger content = big_integer_from_int64(0);
+
+    for (int i = 0; i <= p->degree; i++)
+    {
+        const Rational *c = &p->coefficients[i];
+
+        BigInteger scaled = big_integer_multiply(&c->numerator, &multiple);
+        big_integer_divide(&scaled, &c->denominator, &numerators[i], NULL);
+        free_big_integer(&scaled);
+
+        if (!big_integer_is_one(&content))
+        {
+            BigInteger divisor = big_integer_gcd(&content, &numerators[i]);
+            free_big_integer(&content);
+            content = divisor;
+        }
+    }
+
+    RationalPolynomial result = {.degree = p->degree};
+    result.coefficients = allocate_or_exit((p->degree + 1) * sizeof(Rational));
+
+    for (int i = 0; i <= p->degree; i++)
+    {
+        BigInteger numerator;
+
+        if (big_integer_is_zero(&content))
+            numerator = big_integer_from_int64(0);
+        else
+            big_integer_divide(&numerators[i], &content, &numerator, NULL);
+
+        result.coefficients[i] = (Rational){.numerator = numerator, .denominator = big_integer_from_int64(1)};
+        free_big_integer(&numerators[i]);
+    }
+
+    free(numerators);
+    free_big_integer(&multiple);
+    free_big_integer(&content);
+
+    return result;
+}
+
+// Integer polynomial as bare numerators, for the subresultant sequence below
+typedef struct
+{
+    int degree;
+    BigInteger *coefficients;
+} IntegerPolynomial;
+
+
+static BigInteger big_integer_power(const BigInteger *base, int exponent)
+{
+    BigInteger result = big_integer_from_int64(1);
+
+    for (int i = 0; i < exponent; i++)
+    {
+        BigInteger next = big_integer_multiply(&result, base);
+        free_big_integer(&result);
+        result = next;
+    }
+
+    return result;
+}
+
+static void replace(BigInteger *target, BigInteger value)
+{
+    free_big_integer(target);
+    *target = value;
+}
+
+// lc(b)^(deg a - deg b + 1) a mod b, computed without fractions. Returns a polynomial
+// of degree -1 for zero.
+static IntegerPolynomial pseudo_remainder(const IntegerPolynomial *a, const IntegerPolynomial *b)
+{
+    IntegerPolynomial r = {.degree = a->degree};
+    r.coefficients = allocate_or_exit((a->degree + 1) * sizeof(BigInteger));
+
+    for (int i = 0; i <= a->degree; i++)
+        r.coefficients[i] = copy_big_integer(&a->coefficients[i]);
+
+    const BigInteger *lead = &b->coefficients[b->degree];
+    int steps = a->degree - b->degree + 1;
+
+    // r = lc(b) r - lc(r) x^shift b, cancelling the top term each time
+    while (r.degree >= b->degree)
+    {
+        int shift = r.degree - b->degree;
+        BigInteger top = copy_big_integer(&r.coefficients[r.degree]);
+
+        for (int i = 0; i < r.degree; i++)
+            replace(&r.coefficients[i], big_integer_multiply(&r.coefficients[i], lead));
+
+        for (int j = 0; j < b->degree; j++)
+        {
+            BigInteger product = big_integer_multiply(&top, &b->coefficients[j]);
+            replace(&r.coefficients[shift + j], big_integer_subtract(&r.coefficients[shift + j], &product));
+            free_big_integer(&product);
+        }
+
+        free_big_integer(&top);
+        free_big_integer(&r.coefficients[r.degree]);
+        r.degree--;
+        steps--;
+
+        while (r.degree >= 0 && big_integer_is_zero(&r.coefficients[r.degree]))
+        {
+            free_big_integer(&r.coefficients[r.degree]);
+            r.degree--;
+        }
+    }
+
+    // the steps skipped by cancelled terms still owe their factor of lc(b)
+    if (steps > 0 && r.degree >= 0)
+    {
+        BigInteger factor = big_integer_power(lead, steps);
+
+        for (int i = 0; i <= r.degree; i++)
+            replace(&r.coefficients[i], big_integer_multiply(&r.coefficients[i], &factor));
+
+        free_big_integer(&factor);
+    }
+
+    return r;
+}
+
+int rational_polynomial_subresultant_sturm(const RationalPolynomial *p, RationalPolynomial *members)
+{
+    // a constant is its own chain
+    if (p->degree < 1)
+    {
+        members[0] = copy_rational_polynomial(p);
+        return 1;
+    }
+
+    int capacity = p->degree + 1;
+    IntegerPolynomial *r = allocate_or_exit(capacity * sizeof(IntegerPolynomial));
+
+    // r[0] = p, r[1] = p'
+    r[0].degree = p->degree;
+    r[0].coefficients = allocate_or_exit((p->degree + 1) * sizeof(BigInteger));
+    for (int i = 0; i <= p->degree; i++)
+        r[0].coefficients[i] = copy_big_integer(&p->coefficients[i].numerator);
+
+    r[1].degree = p->degree - 1;
+    r[1].coefficients = allocate_or_exit(p->degree * sizeof(BigInteger));
+    for (int i = 1; i <= p->degree; i++)
+    {
+        BigInteger power = big_integer_from_int64(i);
+        r[1].coefficients[i - 1] = big_integer_multiply(&r[0].coefficients[i], &power);
+        free_big_integer(&power);
+    }
+
+    // sign[i] makes sign[i] r[i] a positive multiple of the classical Sturm member
+    int *sign = allocate_or_exit(capacity * sizeof(int));
+    sign[0] = 1;
+    sign[1] = 1;
+
+    int count = 2;
+
+    // Collins and Brown: r[i + 1] = prem(r[i - 1], r[i]) / beta with
+    // beta_1 = (-1)^(d_1 + 1), psi_1 = -1 and for later steps
+    // psi_i = (-lc(r[i - 1]))^d_(i - 1) / psi_(i - 1)^(d_(i - 1) - 1),
+    // beta_i = -lc(r[i - 1]) psi_i^d_i, where d_i = deg r[i - 1] - deg r[i]
+    BigInteger psi = big_integer_from_int64(-1);
+    int previous_d = 0;
+
+    while (r[count - 1].degree > 0)
+    {
+        int i = count - 1;
+        int d = r[i - 1].degree - r[i].degree;
+
+        BigInteger beta;
+
+        if (i == 1)
+        {
+            beta = big_integer_from_int64((d % 2) ? 1 : -1);
+        }
+        else
+        {
+            BigInteger minus_lead = big_integer_negate(&r[i - 1].coefficients[r[i - 1].degree]);
+            BigInteger numerator = big_integer_power(&minus_lead, previous_d);
+            BigInteger denominator = big_integer_power(&psi, previous_d - 1);
+
+            free_big_integer(&psi);
+            big_integer_divide(&numerator, &denominator, &psi, NULL);
+
+            BigInteger psi_power = big_integer_power(&psi, d);
+            beta = big_integer_multiply(&minus_lead, &psi_power);
+
+            free_big_integer(&minus_lead);
+            free_big_integer(&numerator);
+            free_big_integer(&denominator);
+            free_big_integer(&psi_power);
+        }
+
+        IntegerPolynomial next = pseudo_remainder(&r[i - 1], &r[i]);
+
+        if (next.degree < 0)
+        {
+            free(next.coefficients);
+            free_big_integer(&beta);
+            break;
+        }
+
+        for (int j = 0; j <= next.degree; j++)
+        {
+            BigInteger quotient;
+            big_integer_divide(&next.coefficients[j], &beta, &quotient, NULL);
+            replace(&next.coefficients[j], quotient);
+        }
+
+        // r[i + 1] = lc(r[i])^(d + 1) / beta rem(r[i - 1], r[i]), and the remainder
+        // of the Sturm members is -sign[i - 1] times the next member
+        int lead_sign = r[i].coefficients[r[i].degree].sign;
+        int factor_sign = ((d + 1) % 2 ? lead_sign : 1) * beta.sign;
+
+        sign[count] = -sign[i - 1] * factor_sign;
+        r[count++] = next;
+
+        previous_d = d;
+        free_big_integer(&beta);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        members[i].degree = r[i].degree;
+        members[i].coefficients = allocate_or_exit((r[i].degree + 1) * sizeof(Rational));
+
+        for (int j = 0; j <= r[i].degree; j++)
+        {
+            BigInteger numerator = r[i].coefficients[j];
+            numerator.sign *= sign[i];
+            members[i].coefficients[j] = (Rational){.numerator = numerator, .denominator = big_integer_from_int64(1)};
+        }
+
+        // the coefficients now belong to members
+        free(r[i].coefficients);
+    }
+
+    free(r);
+    free(sign);
+    free_big_integer(&psi);
+
+    return count;
+}
+
+bool rational_polynomial_is_zero(const RationalPolynomial *p)
+{
+    return p->degree == 0 && rational_is_zero(&p->coefficients[0]);
+}
+
+// Two's complement values of at most 127 bits, which wrap correctly in the unsigned
+// arithmetic of uint128.h
+static Uint128 to_wide(const BigInteger *a)
+{
+    Uint128 value = {.low = 0, .high = 0};
+
+    if (a->size > 0)
+        value.low = a->limbs[0];
+    if (a->size > 1)
+        value.low |= (uint64_t)a->limbs[1] << 32;
+    if (a->size > 2)
+        value.high = a->limbs[2];
+    if (a->size > 3)
+        value.high |= (uint64_t)a->limbs[3] << 32;
+
+    return (a->sign < 0) ? uint128_subtract((Uint128){0, 0}, value) : value;
+}
+
+static Uint128 wide_shift_left(Uint128 a, int bits)
+{
+    if (bits == 0)
+        return a;
+    if (bits >= 64)
+        return (Uint128){.low = 0, .high = a.low << (bits - 64)};
+
+    return (Uint128){.low = a.low << bits, .high = (a.high << bits) | (a.low >> (64 - bits))};
+}
+
+// a m modulo 2^128, with m sign extended
+static Uint128 wide_multiply(Uint128 a, int64_t m)
+{
+    uint64_t m_low = (uint64_t)m;
+    uint64_t m_high = (m < 0) ? UINT64_MAX : 0;
+
+    Uint128 product = uint128_multiply(a.low, m_low);
+    product.high += a.high * m_low + a.low * m_high;
+
+    return product;
+}
+
+// integer_sign_at for values known to fit in 127 bits, in machine arithmetic
+static int small_integer_sign_at(const RationalPolynomial *p, int64_t m, int k)
+{
+    Uint128 value = to_wide(&p->coefficients[p->degree].numerator);
+
+    for (int i = p->degree - 1; i >= 0; i--)
+    {
+        Uint128 term = wide_shift_left(to_wide(&p->coefficients[i].numerator), k * (p->degree - i));
+        value = uint128_add(wide_multiply(value, m), term);
+    }
+
+    if (value.high >> 63)
+        return -1;
+
+    return (value.low != 0 || value.high != 0);
+}
+
+// Every double is m / 2^k, so for integer coefficients 2^(k degree) p(x) is the
+// integer sum of c_i m^i 2^(k (degree - i)): one Horner pass of big integer products
+// and shifts, with none of the gcds of rational arithmetic. Small enough members and
+// points, such as the low members of a chain at short dyadic endpoints, stay in 128
+// bit integers.
+static int integer_sign_at(const RationalPolynomial *p, double x)
+{
+    int exponent;
+    double fraction = frexp(x, &exponent);
+
+    double mantissa = ldexp(fraction, 53);
+    int k = 53 - exponent;
+
+    while (k > 0 && fmod(mantissa, 2.0) == 0.0)
+    {
+        mantissa /= 2.0;
+        k--;
+    }
+
+    if (k < 0)
+    {
+        mantissa = x;
+        k = 0;
+    }
+
+    // every partial sum is below (degree + 1) 2^(bits + degree width) in magnitude
+    int width = 0;
+    frexp(mantissa, &width);
+    if (width < k)
+        width = k;
+
+    int bits = 0;
+    for (int i = 0; i <= p->degree; i++)
+    {
+        int length = big_integer_bit_length(&p->coefficients[i].numerator);
+        if (length > bits)
+            bits = length;
+    }
+
+    int terms = 0;
+    frexp(p->degree + 1, &terms);
+
+    if (bits + p->degree * width + terms <= 126 && fabs(mantissa) < 0x1p62)
+        return small_integer_sign_at(p, (int64_t)mantissa, k);
+
+    BigInteger m = big_integer_from_double(mantissa);
+
+    BigInteger value = copy_big_integer(&p->coefficients[p->degree].numerator);
+
+    for (int i = p->degree - 1; i >= 0; i--)
+    {
+        BigInteger product = big_integer_multiply(&value, &m);
+        BigInteger term = big_integer_shift_left(&p->coefficients[i].numerator, k * (p->degree - i));
+
+        free_big_integer(&value);
+        value = big_integer_add(&product, &term);
+
+        free_big_integer(&product);
+        free_big_integer(&term);
+    }
+
+    int sign = value.sign;
+
+    free_big_integer(&value);
+    free_big_integer(&m);
+
+    return sign;
+}
+
+int rational_polynomial_sign_at(const RationalPolynomial *p, double x)
+{
+    bool integer = true;
+    for (int i = 0; i <= p->degree && integer; i++)
+        integer = rational_is_integer(&p->coefficients[i]);
+
+    if (integer)
+        return integer_sign_at(p, x);
+
+    Rational point = rational_from_double(x);
+    Rational value = copy_rational(&p->coefficients[p->degree]);
+
+    for (int i = p->degree - 1; i >= 0; i--)
+    {
+        Rational product = rational_multiply(&value, &point);
+        free_rational(&value);
+
+        value = rational_add(&product, &p->coefficients[i]);
+        free_rational(&product);
+    }
+
+    int sign = rational_sign(&value);
+
+    free_rational(&value);
+    free_rational(&point);
+
+    return sign;
+}
@@ -1,15 +1,24 @@
 #include <math.h>
+#include <float.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
 #include "sturm_sequence.h"
 #include "polynomial.h"
 
+static void pack_sturm_sequence(SturmSequence *sequence);
+static int count_changes_in_signs(const int *signs, int count);
+
 SturmSequence create_sturm_sequence(const Polynomial *p)
 {
+    if (p->degree > STURM_EXACT_DEGREE)
+        return create_exact_sturm_sequence(p);
+
     SturmSequence sequence;
     sequence.count = 0;
     sequence.polynomials = NULL;
+    sequence.exact_polynomials = NULL;
 
     Polynomial p0 = copy_polynomial(p);
     Polynomial p1 = polynomial_derivative(p);
@@ -42,57 +51,144 @@ SturmSequence create_sturm_sequence(const Polynomial *p)
         sequence.polynomials[sequence.count - 1] = negative_remainder;
     }
 
+    pack_sturm_sequence(&sequence);
+
     return sequence;
 }
 
-static int sign_of_polynomial_at(const Polynomial *p, ExtendedValue x)
+// p rounded after scaling by the power of two that brings its largest integer
+// coefficient just below one, so members of any size convert without overflow
+static Polynomial scaled_to_double(const RationalPolynomial *p)
 {
+    int length = 0;
+    for (int i = 0; i <= p->degree; i++)
+    {
+        int bits = big_integer_bit_length(&p->coefficients[i].numerator);
+        if (bits > length)
+            length = bits;
+    }
 
-    switch (x.type)
+    double *coefficients = malloc((p->degree + 1) * sizeof(double));
+    if (!coefficients)
     {
-    case VALUE_FINITE:
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i <= p->degree; i++)
+        coefficients[i] = big_integer_to_double_scaled(&p->coefficients[i].numerator, -length);
+
+    Polynomial result = create_polynomial(coefficients, p->degree);
+    free(coefficients);
+
+    return result;
+}
+
+// Every double is a dyadic rational, so p's primitive part has integer coefficients
+// and the subresultant sequence builds the chain without a single fraction. Its
+// members are then reduced to primitive integer polynomials, which keeps them as
+// small as possible for evaluation; the positive scale factors leave every sign, and
+// so every count, as in the classical chain.
+SturmSequence create_exact_sturm_sequence(const Polynomial *p)
+{
+    SturmSequence sequence;
+
+    RationalPolynomial value = rational_polynomial_from_polynomial(p);
+    RationalPolynomial primitive = rational_polynomial_primitive_part(&value);
+
+    int capacity = p->degree + 1;
+    sequence.exact_polynomials = malloc(capacity * sizeof(RationalPolynomial));
+    if (!sequence.exact_polynomials)
     {
-        double val = polynomial_evaluate(p, x.value);
-        if (val > 0)
-            return 1;
-        if (val < 0)
-            return -1;
-        return 0;
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
     }
-    case VALUE_POS_INF:
-    case VALUE_NEG_INF:
+
+    sequence.count = rational_polynomial_subresultant_sturm(&primitive, sequence.exact_polynomials);
+
+    free_rational_polynomial(&value);
+    free_rational_polynomial(&primitive);
+
+    for (int i = 1; i < sequence.count; i++)
     {
-        ExtendedValue limit = polynomial_limit(p, x);
+        RationalPolynomial reduced = rational_polynomial_primitive_part(&sequence.exact_polynomials[i]);
+        free_rational_polynomial(&sequence.exact_polynomials[i]);
+        sequence.exact_polynomials[i] = reduced;
+    }
 
-        if (limit.type == VALUE_POS_INF)
-            return 1;
+    sequence.polynomials = malloc(sequence.count * sizeof(Polynomial));
+    if (!sequence.polynomials)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
 
-        if (limit.type == VALUE_NEG_INF)
-            return -1;
+    // p itself is kept unscaled; callers test it for zeros directly
+    sequence.polynomials[0] = copy_polynomial(p);
+    for (int i = 1; i < sequence.count; i++)
+        sequence.polynomials[i] = scaled_to_double(&sequence.exact_polynomials[i]);
 
-        if (limit.type == VALUE_FINITE)
-        {
-            if (limit.value > 0)
-                return 1;
-            if (limit.value < 0)
-                return -1;
-        }
+    pack_sturm_sequence(&sequence);
 
-        return 0;
+    // signs at infinity from the exact leading coefficients, which rounding could
+    // only lose by underflow
+    int *signs_at_neg_inf = malloc(2 * sequence.count * sizeof(int));
+    if (!signs_at_neg_inf)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
     }
-    default:
-        return 0;
+    int *signs_at_pos_inf = signs_at_neg_inf + sequence.count;
+
+    for (int i = 0; i < sequence.count; i++)
+    {
+        const RationalPolynomial *member = &sequence.exact_polynomials[i];
+        int lead = rational_sign(&member->coefficients[member->degree]);
+
+        signs_at_pos_inf[i] = lead;
+        signs_at_neg_inf[i] = (member->degree % 2) ? -lead : lead;
+    }
+
+    sequence.sign_changes_at_neg_inf = count_changes_in_signs(signs_at_neg_inf, sequence.count);
+    sequence.sign_changes_at_pos_inf = count_changes_in_signs(signs_at_pos_inf, sequence.count);
+
+    free(signs_at_neg_inf);
+
+    return sequence;
+}
+
+// Members evaluated with stack scratch space; longer chains use the heap
+#define STURM_STACK_MEMBERS 64
+
+static int sign_of_limit(const Polynomial *p, ExtendedValue x)
+{
+    ExtendedValue limit = polynomial_limit(p, x);
+
+    if (limit.type == VALUE_POS_INF)
+        return 1;
+
+    if (limit.type == VALUE_NEG_INF)
+        return -1;
+
+    if (limit.type == VALUE_FINITE)
+    {
+        if (limit.value > 0)
+            return 1;
+        if (limit.value < 0)
+            return -1;
     }
+
+    return 0;
 }
 
-static int count_sign_changes(const SturmSequence *sequence, ExtendedValue x)
+static int count_changes_in_signs(const int *signs, int count)
 {
     int sign_changes = 0;
-    int previous_sign = sign_of_polynomial_at(&sequence->polynomials[0], x);
+    int previous_sign = signs[0];
 
-    for (int i = 1; i < sequence->count; i++)
+    for (int i = 1; i < count; i++)
     {
-        int current_sign = sign_of_polynomial_at(&sequence->polynomials[i], x);
+        int current_sign = signs[i];
 
         if (current_sign != 0 && previous_sign != 0 && current_sign != previous_sign)
         {
@@ -108,6 +204,261 @@ static int count_sign_changes(const SturmSequence *sequence, ExtendedValue x)
     return sign_changes;
 }
 
+static int count_sign_changes_at_infinity(const SturmSequence *sequence, ExtendedValue x)
+{
+    int *signs = malloc(sequence->count * sizeof(int));
+    if (!signs)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < sequence->count; i++)
+        signs[i] = sign_of_limit(&sequence->polynomials[i], x);
+
+    int sign_changes = count_changes_in_signs(signs, sequence->count);
+
+    free(signs);
+    return sign_changes;
+}
+
+static void pack_sturm_sequence(SturmSequence *sequence)
+{
+    int count = sequence->count;
+
+    sequence->max_degree = sequence->polynomials[0].degree;
+    sequence->packed_coefficients = calloc((sequence->max_degree + 1) * count, sizeof(double));
+
+    if (!sequence->packed_coefficients)
+    {
+        perror("calloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const Polynomial *member = &sequence->polynomials[i];
+
+        for (int j = 0; j <= member->degree; j++)
+            sequence->packed_coefficients[j * count + i] = member->coefficients[j];
+    }
+
+    sequence->packed_float_coefficients = malloc((sequence->max_degree + 1) * count * sizeof(float));
+
+    if (!sequence->packed_float_coefficients)
+    {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int k = 0; k < (sequence->max_degree + 1) * count; k++)
+    {
+        double c = fabs(sequence->packed_coefficients[k]);
+
+        // the float bound assumes relative rounding of every coefficient
+        if (c != 0.0 && (c < FLT_MIN || c > FLT_MAX / 4.0))
+        {
+            free(sequence->packed_float_coefficients);
+            sequence->packed_float_coefficients = NULL;
+            break;
+        }
+
+        sequence->packed_float_coefficients[k] = (float)sequence->packed_coefficients[k];
+    }
+
+    sequence->sign_changes_at_neg_inf = count_sign_changes_at_infinity(sequence, extended_value_neg_infinity());
+    sequence->sign_changes_at_pos_inf = count_sign_changes_at_infinity(sequence, extended_value_pos_infinity());
+}
+
+// Float sweep over the packed block; decides the sign of each member whose value
+// clears an a priori bound and leaves 0 for the rest. Returns the number decided.
+static int float_signs_of_sequence_at(const SturmSequence *sequence, double x, float *values, float *magnitudes, int *signs)
+{
+    int count = sequence->count;
+
+    for (int i = 0; i < count; i++)
+        signs[i] = 0;
+
+    if (!sequence->packed_float_coefficients || !(fabs(x) < FLT_MAX / 4.0) || (x != 0.0 && fabs(x) < FLT_MIN))
+        return 0;
+
+    float xf = (float)x;
+    float abs_x = fabsf(xf);
+
+    for (int i = 0; i < count; i++)
+    {
+        values[i] = 0.0f;
+        magnitudes[i] = 0.0f;
+    }
+
+    for (int j = sequence->max_degree; j >= 0; j--)
+    {
+        const float *column = sequence->packed_float_coefficients + j * count;
+
+        for (int i = 0; i < count; i++)
+        {
+            values[i] = values[i] * xf + column[i];
+            magnitudes[i] = magnitudes[i] * abs_x + fabsf(column[i]);
+        }
+    }
+
+    // absolute error of gradual underflow: at most FLT_MIN per operation, carried
+    // up through the remaining powers of x
+    double powers = 0.0;
+    for (int j = 0; j <= sequence->max_degree; j++)
+        powers = powers * fabs(x) + 1.0;
+
+    double underflow = 2.0 * (sequence->max_degree + 1) * FLT_MIN * powers;
+    double u = FLT_EPSILON / 2.0;
+    int decided = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        // rounding x and the coefficients to float adds n + 1 factors of (1 + u) to
+        // the 2n of Horner's scheme; the spare ones cover the rounded magnitude
+        int degree = sequence->polynomials[i].degree;
+        double gamma = (3.0 * degree + 4.0) * u / (1.0 - (3.0 * degree + 4.0) * u);
+
+        if (fabs(values[i]) > gamma * magnitudes[i] + underflow)
+        {
+            signs[i] = values[i] > 0 ? 1 : -1;
+            decided++;
+        }
+    }
+
+    return decided;
+}
+
+// Sign of member i from its double value and Horner magnitude, re-evaluated exactly
+// when the error bound straddles zero
+static int settle_member_sign(const SturmSequence *sequence, int i, double x, double value, double magnitude)
+{
+    double u = DBL_EPSILON / 2.0;
+    int degree = sequence->polynomials[i].degree;
+    double gamma = 2.0 * degree * u / (1.0 - 2.0 * degree * u);
+
+    if (fabs(value) > 2.0 * gamma * magnitude)
+        return value > 0 ? 1 : -1;
+    if (sequence->exact_polynomials)
+        return rational_polynomial_sign_at(&sequence->exact_polynomials[i], x);
+    return polynomial_sign_at(&sequence->polynomials[i], x);
+}
+
+// Decides every member whose sign is still 0. With nothing decided yet, all members
+// are evaluated in one sweep over the packed block, whose inner loop runs across
+// members, so it is contiguous and vectorizes. Otherwise only the undecided members
+// are evaluated, each along its own coefficients.
+static void signs_of_sequence_at(const SturmSequence *sequence, double x, int decided, double *values, double *magnitudes,
+                                 int *signs)
+{
+    int count = sequence->count;
+    double abs_x = fabs(x);
+
+    if (decided > 0)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (signs[i] != 0)
+                continue;
+
+            const Polynomial *member = &sequence->polynomials[i];
+            double value = member->coefficients[member->degree];
+            double magnitude = fabs(value);
+
+            for (int j = member->degree - 1; j >= 0; j--)
+            {
+                value = value * x + member->coefficients[j];
+                magnitude = magnitude * abs_x + fabs(member->coefficients[j]);
+            }
+
+            signs[i] = settle_member_sign(sequence, i, x, value, magnitude);
+        }
+
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        values[i] = 0.0;
+        magnitudes[i] = 0.0;
+    }
+
+    for (int j = sequence->max_degree; j >= 0; j--)
+    {
+        const double *column = sequence->packed_coefficients + j * count;
+
+        for (int i = 0; i < count; i++)
+        {
+            values[i] = values[i] * x + column[i];
+            magnitudes[i] = magnitudes[i] * abs_x + fabs(column[i]);
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+        signs[i] = settle_member_sign(sequence, i, x, values[i], magnitudes[i]);
+}
+
+static int count_sign_changes(const SturmSequence *sequence, ExtendedValue x)
+{
+    switch (x.type)
+    {
+    case VALUE_NEG_INF:
+        return sequence->sign_changes_at_neg_inf;
+    case VALUE_POS_INF:
+        return sequence->sign_changes_at_pos_inf;
+    case VALUE_FINITE:
+        break;
+    default:
+        return 0;
+    }
+
+    double stack_values[STURM_STACK_MEMBERS];
+    double stack_magnitudes[STURM_STACK_MEMBERS];
+    float stack_float_values[STURM_STACK_MEMBERS];
+    float stack_float_magnitudes[STURM_STACK_MEMBERS];
+    int stack_signs[STURM_STACK_MEMBERS];
+
+    double *values = stack_values;
+    double *magnitudes = stack_magnitudes;
+    float *float_values = stack_float_values;
+    float *float_magnitudes = stack_float_magnitudes;
+    int *signs = stack_signs;
+
+    if (sequence->count > STURM_STACK_MEMBERS)
+    {
+        values = malloc(sequence->count * sizeof(double));
+        magnitudes = malloc(sequence->count * sizeof(double));
+        float_values = malloc(sequence->count * sizeof(float));
+        float_magnitudes = malloc(sequence->count * sizeof(float));
+        signs = malloc(sequence->count * sizeof(int));
+
+        if (!values || !magnitudes || !float_values || !float_magnitudes || !signs)
+        {
+            perror("malloc failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // double and exact arithmetic only see the members float cannot settle
+    int decided = float_signs_of_sequence_at(sequence, x.value, float_values, float_magnitudes, signs);
+
+    if (decided < sequence->count)
+        signs_of_sequence_at(sequence, x.value, decided, values, magnitudes, signs);
+
+    int sign_changes = count_changes_in_signs(signs, sequence->count);
+
+    if (sequence->count > STURM_STACK_MEMBERS)
+    {
+        free(values);
+        free(magnitudes);
+        free(float_values);
+        free(float_magnitudes);
+        free(signs);
+    }
+
+    return sign_changes;
+}
+
 int sturm_sequence_count_real_roots_in_interval(const SturmSequence *sequence, Interval interval)
 {
     int sign_changes_a = count_sign_changes(sequence, interval.lower_bound);
@@ -124,5 +475,21 @@ void free_sturm_sequence(SturmSequence *sequence)
     }
     free(sequence->polynomials);
     sequence->polynomials = NULL;
+
+    if (sequence->exact_polynomials)
+    {
+        for (int i = 0; i < sequence->count; i++)
+            free_rational_polynomial(&sequence->exact_polynomials[i]);
+
+        free(sequence->exact_polynomials);
+        sequence->exact_polynomials = NULL;
+    }
+
     sequence->count = 0;
+
+    free(sequence->packed_coefficients);
+    sequence->packed_coefficients = NULL;
+    free(sequence->packed_float_coefficients);
+    sequence->packed_float_coefficients = NULL;
+    sequence->max_degree = 0;
 }
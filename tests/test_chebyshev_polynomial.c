@@ -0,0 +1,169 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include "polynomial.h"
+#include "chebyshev_polynomial.h"
+
+/* ---------------------------------------
+ * Helpers
+ * --------------------------------------- */
+static Polynomial make_poly(int degree, double *coeffs)
+{
+    Polynomial p;
+    p.degree = degree;
+    p.coefficients = coeffs;
+    return p;
+}
+
+/* ---------------------------------------
+ * Conversion tests
+ * --------------------------------------- */
+
+static void test_chebyshev_basis_on_unit_interval(void **state)
+{
+    (void)state;
+
+    double c[] = {0.0, -3.0, 0.0, 4.0}; // 4x^3 - 3x = T_3(x)
+    Polynomial p = make_poly(3, c);
+
+    ChebyshevPolynomial cheb = chebyshev_from_polynomial(&p, -1.0, 1.0);
+
+    assert_int_equal(cheb.degree, 3);
+    assert_float_equal(cheb.coefficients[0], 0.0, 1e-12);
+    assert_float_equal(cheb.coefficients[1], 0.0, 1e-12);
+    assert_float_equal(cheb.coefficients[2], 0.0, 1e-12);
+    assert_float_equal(cheb.coefficients[3], 1.0, 1e-12);
+
+    free_chebyshev_polynomial(&cheb);
+}
+
+static void test_chebyshev_round_trip(void **state)
+{
+    (void)state;
+
+    double c[] = {2.0, -1.0, 0.5, 3.0, -0.25, 1.0};
+    Polynomial p = make_poly(5, c);
+
+    ChebyshevPolynomial cheb = chebyshev_from_polynomial(&p, -2.0, 5.0);
+    Polynomial back = chebyshev_to_polynomial(&cheb);
+
+    assert_int_equal(back.degree, 5);
+    for (int i = 0; i <= 5; i++)
+        assert_float_equal(back.coefficients[i], c[i], 1e-9);
+
+    free_polynomial(&back);
+    free_chebyshev_polynomial(&cheb);
+}
+
+/* ---------------------------------------
+ * Evaluation tests
+ * --------------------------------------- */
+
+static void test_chebyshev_evaluate_matches_monomial(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, 2.0, -3.0, 0.5, 4.0, -1.0, 0.75};
+    Polynomial p = make_poly(6, c);
+
+    ChebyshevPolynomial cheb = chebyshev_from_polynomial(&p, 1.0, 3.0);
+
+    double xs[21];
+    double ys[21];
+    for (int i = 0; i < 21; i++)
+        xs[i] = 1.0 + 0.1 * i;
+
+    chebyshev_evaluate_many(&cheb, xs, ys, 21);
+
+    for (int i = 0; i < 21; i++)
+    {
+        double expected = polynomial_evaluate(&p, xs[i]);
+        assert_float_equal(chebyshev_evaluate(&cheb, xs[i]), expected, 1e-9 * fabs(expected) + 1e-9);
+        assert_float_equal(ys[i], chebyshev_evaluate(&cheb, xs[i]), 1e-12 * fabs(expected) + 1e-12);
+    }
+
+    free_chebyshev_polynomial(&cheb);
+}
+
+static void test_chebyshev_derivative(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, -2.0, 0.5, 3.0, -1.0}; // -x^4 + 3x^3 + 0.5x^2 - 2x + 1
+    Polynomial p = make_poly(4, c);
+    Polynomial dp = polynomial_derivative(&p);
+
+    ChebyshevPolynomial cheb = chebyshev_from_polynomial(&p, -1.5, 2.5);
+    ChebyshevPolynomial derivative = chebyshev_derivative(&cheb);
+
+    assert_int_equal(derivative.degree, 3);
+    for (double x = -1.5; x <= 2.5; x += 0.25)
+        assert_float_equal(chebyshev_evaluate(&derivative, x), polynomial_evaluate(&dp, x), 1e-9);
+
+    free_chebyshev_polynomial(&derivative);
+    free_chebyshev_polynomial(&cheb);
+    free_polynomial(&dp);
+}
+
+static void test_chebyshev_truncate_within_tolerance(void **state)
+{
+    (void)state;
+
+    // truncated series of exp(x): the Chebyshev tail decays much faster than the monomial one
+    double c[16];
+    c[0] = 1.0;
+    for (int i = 1; i < 16; i++)
+        c[i] = c[i - 1] / i;
+    Polynomial p = make_poly(15, c);
+
+    ChebyshevPolynomial cheb = chebyshev_from_polynomial(&p, -1.0, 1.0);
+    ChebyshevPolynomial truncated = chebyshev_truncate(&cheb, 1e-8);
+
+    assert_true(truncated.degree < 12);
+    for (double x = -1.0; x <= 1.0; x += 0.125)
+        assert_float_equal(chebyshev_evaluate(&truncated, x), polynomial_evaluate(&p, x), 1e-8 + 1e-14);
+
+    free_chebyshev_polynomial(&truncated);
+    free_chebyshev_polynomial(&cheb);
+}
+
+static void test_chebyshev_constant(void **state)
+{
+    (void)state;
+
+    double c[] = {7.0};
+    Polynomial p = make_poly(0, c);
+
+    ChebyshevPolynomial cheb = chebyshev_from_polynomial(&p, 0.0, 10.0);
+    ChebyshevPolynomial derivative = chebyshev_derivative(&cheb);
+
+    assert_float_equal(chebyshev_evaluate(&cheb, 3.0), 7.0, 0.0);
+    assert_int_equal(derivative.degree, 0);
+    assert_float_equal(chebyshev_evaluate(&derivative, 3.0), 0.0, 0.0);
+
+    free_chebyshev_polynomial(&derivative);
+    free_chebyshev_polynomial(&cheb);
+}
+
+/* ---------------------------------------
+ * Test runner
+ * --------------------------------------- */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_chebyshev_basis_on_unit_interval),
+        cmocka_unit_test(test_chebyshev_round_trip),
+
+        cmocka_unit_test(test_chebyshev_evaluate_matches_monomial),
+        cmocka_unit_test(test_chebyshev_derivative),
+        cmocka_unit_test(test_chebyshev_truncate_within_tolerance),
+        cmocka_unit_test(test_chebyshev_constant),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,323 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include "big_integer.h"
+#include "rational.h"
+#include "rational_polynomial.h"
+#include "mod_polynomial.h"
+
+/* ---------------------------------
+ * Helpers
+ * --------------------------------- */
+static BigInteger power_of_ten(int exponent)
+{
+    BigInteger result = big_integer_from_int64(1);
+    BigInteger ten = big_integer_from_int64(10);
+
+    for (int i = 0; i < exponent; i++)
+    {
+        BigInteger next = big_integer_multiply(&result, &ten);
+        free_big_integer(&result);
+        result = next;
+    }
+
+    free_big_integer(&ten);
+    return result;
+}
+
+static void assert_rational_equal(const Rational *r, long long numerator, long long denominator)
+{
+    Rational expected = create_rational(big_integer_from_int64(numerator), big_integer_from_int64(denominator));
+    assert_int_equal(rational_compare(r, &expected), 0);
+    free_rational(&expected);
+}
+
+/* ---------------------------------
+ * Test: big integers past 64 bits
+ * --------------------------------- */
+static void test_big_integer_arithmetic(void **state)
+{
+    (void)state;
+
+    // x = 10^30 + 7, y = 10^20 - 3
+    BigInteger a = power_of_ten(30);
+    BigInteger b = power_of_ten(20);
+    BigInteger seven = big_integer_from_int64(7);
+    BigInteger three = big_integer_from_int64(3);
+
+    BigInteger x = big_integer_add(&a, &seven);
+    BigInteger y = big_integer_subtract(&b, &three);
+    BigInteger product = big_integer_multiply(&x, &y);
+
+    BigInteger quotient, remainder;
+    big_integer_divide(&product, &y, &quotient, &remainder);
+    assert_int_equal(big_integer_compare(&quotient, &x), 0);
+    assert_true(big_integer_is_zero(&remainder));
+    free_big_integer(&quotient);
+    free_big_integer(&remainder);
+
+    // truncating division: (-x y + 7) / x = -(y - 1) remainder 7 - x
+    BigInteger negative = big_integer_negate(&product);
+    BigInteger dividend = big_integer_add(&negative, &seven);
+    big_integer_divide(&dividend, &x, &quotient, &remainder);
+
+    BigInteger check = big_integer_multiply(&quotient, &x);
+    BigInteger recombined = big_integer_add(&check, &remainder);
+    assert_int_equal(big_integer_compare(&recombined, &dividend), 0);
+    assert_int_equal(quotient.sign, -1);
+    assert_int_equal(remainder.sign, -1);
+
+    // gcd(x y, 10^5 x) = x, since y is odd and not a multiple of 5
+    BigInteger scale = power_of_ten(5);
+    BigInteger scaled = big_integer_multiply(&x, &scale);
+    BigInteger divisor = big_integer_gcd(&product, &scaled);
+    assert_int_equal(big_integer_compare(&divisor, &x), 0);
+
+    assert_int_equal(big_integer_bit_length(&a), 100);
+    assert_true(big_integer_to_double(&a) == 1e30);
+
+    // -1.5 2^70 = -3 2^69
+    BigInteger from_double = big_integer_from_double(-0x1.8p70);
+    BigInteger minus_three = big_integer_from_int64(-3);
+    BigInteger expected = big_integer_shift_left(&minus_three, 69);
+    assert_int_equal(big_integer_compare(&from_double, &expected), 0);
+
+    BigInteger *values[] = {&a, &b, &seven, &three, &x, &y, &product, &quotient, &remainder, &negative,
+                            &dividend, &check, &recombined, &scale, &scaled, &divisor, &from_double,
+                            &minus_three, &expected};
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        free_big_integer(values[i]);
+}
+
+/* ---------------------------------
+ * Test: rationals stay in lowest terms
+ * --------------------------------- */
+static void test_rational_arithmetic(void **state)
+{
+    (void)state;
+
+    Rational a = create_rational(big_integer_from_int64(6), big_integer_from_int64(-4));
+    assert_rational_equal(&a, -3, 2);
+
+    Rational b = rational_from_double(0.375);
+    assert_rational_equal(&b, 3, 8);
+
+    Rational sum = rational_add(&a, &b);
+    Rational difference = rational_subtract(&a, &b);
+    Rational product = rational_multiply(&a, &b);
+    Rational quotient = rational_divide(&a, &b);
+
+    assert_rational_equal(&sum, -9, 8);
+    assert_rational_equal(&difference, -15, 8);
+    assert_rational_equal(&product, -9, 16);
+    assert_rational_equal(&quotient, -4, 1);
+    assert_true(rational_is_integer(&quotient));
+
+    // 0.1 is not 1/10 but the nearest dyadic rational, and converts back exactly
+    Rational tenth = rational_from_double(0.1);
+    assert_true(rational_to_double(&tenth) == 0.1);
+    assert_int_equal(big_integer_bit_length(&tenth.denominator), 56);
+
+    Rational third = create_rational(big_integer_from_int64(1), big_integer_from_int64(3));
+    assert_true(rational_to_double(&third) == 1.0 / 3.0);
+    assert_int_equal(rational_compare(&third, &tenth), 1);
+
+    Rational *values[] = {&a, &b, &sum, &difference, &product, &quotient, &tenth, &third};
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        free_rational(values[i]);
+}
+
+/* ---------------------------------
+ * Test: exact polynomial arithmetic
+ * --------------------------------- */
+static void test_rational_polynomial_arithmetic(void **state)
+{
+    (void)state;
+
+    // p = x^3 - 0.1 x + 1/3 (with 0.1 as a double), d = 3x^2 - 1
+    Rational p_coeffs[4] = {
+        create_rational(big_integer_from_int64(1), big_integer_from_int64(3)),
+        rational_from_double(-0.1),
+        rational_from_integer(0),
+        rational_from_integer(1),
+    };
+    Rational d_coeffs[3] = {rational_from_integer(-1), rational_from_integer(0), rational_from_integer(3)};
+
+    RationalPolynomial p = create_rational_polynomial(p_coeffs, 3);
+    RationalPolynomial d = create_rational_polynomial(d_coeffs, 2);
+
+    // p = q d + r exactly
+    RationalPolynomial r;
+    RationalPolynomial q = rational_polynomial_divide(&p, &d, &r);
+
+    assert_int_equal(q.degree, 1);
+    assert_rational_equal(&q.coefficients[1], 1, 3);
+    assert_true(rational_is_zero(&q.coefficients[0]));
+    assert_int_equal(r.degree, 1);
+
+    RationalPolynomial qd = rational_polynomial_multiply(&q, &d);
+    RationalPolynomial recombined = rational_polynomial_add(&qd, &r);
+    RationalPolynomial zero = rational_polynomial_subtract(&recombined, &p);
+    assert_true(rational_polynomial_is_zero(&zero));
+
+    // d' = 6x and its primitive part x
+    RationalPolynomial derivative = rational_polynomial_derivative(&d);
+    RationalPolynomial primitive = rational_polynomial_primitive_part(&derivative);
+    assert_int_equal(primitive.degree, 1);
+    assert_rational_equal(&primitive.coefficients[1], 1, 1);
+
+    // the root 1/sqrt(3) lies strictly between two neighbouring doubles
+    double x = sqrt(1.0 / 3.0);
+    int sign = rational_polynomial_sign_at(&d, x);
+    assert_int_not_equal(sign, 0);
+    assert_int_equal(rational_polynomial_sign_at(&d, nextafter(x, sign > 0 ? 0.0 : 1.0)), -sign);
+    assert_int_equal(rational_polynomial_sign_at(&p, -2.0), -1);
+
+    RationalPolynomial *values[] = {&p, &d, &q, &r, &qd, &recombined, &zero, &derivative, &primitive};
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        free_rational_polynomial(values[i]);
+
+    for (int i = 0; i < 4; i++)
+        free_rational(&p_coeffs[i]);
+    for (int i = 0; i < 3; i++)
+        free_rational(&d_coeffs[i]);
+}
+
+/* ---------------------------------
+ * Test: subresultant Sturm chain
+ * --------------------------------- */
+static void test_subresultant_sturm(void **state)
+{
+    (void)state;
+
+    // p = (x - 1)^2 (x + 2) (x^2 - 3) = x^5 - 6x^3 + 2x^2 + 9x - 6: three distinct roots
+    // besides the double one, which ends the chain at gcd(p, p') = x - 1
+    Rational coefficients[6] = {rational_from_integer(-6), rational_from_integer(9), rational_from_integer(2),
+                                rational_from_integer(-6), rational_from_integer(0), rational_from_integer(1)};
+    RationalPolynomial p = create_rational_polynomial(coefficients, 5);
+
+    RationalPolynomial members[6];
+    int count = rational_polynomial_subresultant_sturm(&p, members);
+
+    assert_int_equal(members[count - 1].degree, 1);
+
+    for (int i = 0; i < count; i++)
+        for (int j = 0; j <= members[i].degree; j++)
+            assert_true(rational_is_integer(&members[i].coefficients[j]));
+
+    // sign changes at -3, 0 and 3 count the distinct roots -2, -sqrt(3), 1 and sqrt(3)
+    int changes[3] = {0, 0, 0};
+    double points[3] = {-3.0, 0.0, 3.0};
+
+    for (int k = 0; k < 3; k++)
+    {
+        int previous = 0;
+        for (int i = 0; i < count; i++)
+        {
+            int sign = rational_polynomial_sign_at(&members[i], points[k]);
+            if (sign != 0 && previous != 0 && sign != previous)
+                changes[k]++;
+            if (sign != 0)
+                previous = sign;
+        }
+    }
+
+    assert_int_equal(changes[0] - changes[1], 2);
+    assert_int_equal(changes[1] - changes[2], 2);
+
+    for (int i = 0; i < count; i++)
+        free_rational_polynomial(&members[i]);
+
+    free_rational_polynomial(&p);
+    for (int i = 0; i < 6; i++)
+        free_rational(&coefficients[i]);
+}
+
+/* ---------------------------------
+ * Test: polynomials modulo a prime
+ * --------------------------------- */
+static void test_mod_polynomial(void **state)
+{
+    (void)state;
+
+    uint64_t prime = mod_polynomial_primes[0];
+
+    // a = (x - 1)^2 (x + 2), b = (x - 1)(x^2 + 1)
+    double a_coefficients[] = {2.0, -3.0, 0.0, 1.0};
+    double b_coefficients[] = {-1.0, 1.0, -1.0, 1.0};
+    Polynomial a_real = create_polynomial(a_coefficients, 3);
+    Polynomial b_real = create_polynomial(b_coefficients, 3);
+
+    ModPolynomial a = mod_polynomial_from_polynomial(&a_real, prime);
+    ModPolynomial b = mod_polynomial_from_polynomial(&b_real, prime);
+
+    assert_true(a.coefficients[1] == prime - 3);
+    assert_true(mod_from_double(-0x1p70, prime) == prime - mod_multiply((uint64_t)1 << 35, (uint64_t)1 << 35, prime));
+
+    // coefficients that polynomial_is_integer accepts round rather than truncate
+    assert_true(mod_from_double(2.9999999999, prime) == 3);
+    assert_true(mod_from_double(-2.9999999999, prime) == prime - 3);
+
+    // gcd(a, b) = x - 1, monic
+    ModPolynomial g = mod_polynomial_gcd(&a, &b);
+    assert_int_equal(g.degree, 1);
+    assert_true(g.coefficients[0] == prime - 1);
+    assert_true(g.coefficients[1] == 1);
+
+    // a b = q g + r with r = 0, and a b - b a = 0
+    ModPolynomial product = mod_polynomial_multiply(&a, &b);
+    ModPolynomial rest;
+    ModPolynomial quotient = mod_polynomial_divide(&product, &g, &rest);
+    assert_int_equal(quotient.degree, 5);
+    assert_true(mod_polynomial_is_zero(&rest));
+
+    ModPolynomial swapped = mod_polynomial_multiply(&b, &a);
+    ModPolynomial zero = mod_polynomial_subtract(&product, &swapped);
+    assert_true(mod_polynomial_is_zero(&zero));
+
+    // a' = 3x^2 - 3 vanishes at 1 and -1; a at -2 and 1 only
+    ModPolynomial derivative = mod_polynomial_derivative(&a);
+    assert_true(mod_polynomial_evaluate(&derivative, prime - 1) == 0);
+    assert_true(mod_polynomial_evaluate(&a, prime - 2) == 0);
+    assert_true(mod_polynomial_evaluate(&a, 2) == 4);
+
+    // a + (p - 1) a = 0
+    ModPolynomial sum = mod_polynomial_add(&a, &a);
+    ModPolynomial difference = mod_polynomial_subtract(&sum, &a);
+    ModPolynomial check = mod_polynomial_subtract(&difference, &a);
+    assert_true(mod_polynomial_is_zero(&check));
+
+    assert_true(mod_multiply(mod_inverse(12345, prime), 12345, prime) == 1);
+
+    ModPolynomial *values[] = {&a, &b, &g, &product, &rest, &quotient, &swapped, &zero, &derivative,
+                               &sum, &difference, &check};
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        free_mod_polynomial(values[i]);
+
+    free_polynomial(&a_real);
+    free_polynomial(&b_real);
+}
+
+/* ---------------------------------
+ * Test runner
+ * --------------------------------- */
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_big_integer_arithmetic),
+        cmocka_unit_test(test_rational_arithmetic),
+        cmocka_unit_test(test_rational_polynomial_arithmetic),
+        cmocka_unit_test(test_subresultant_sturm),
+        cmocka_unit_test(test_mod_polynomial),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
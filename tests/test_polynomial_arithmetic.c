@@ -2,9 +2,13 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
 #include <cmocka.h>
 
 #include "polynomial.h"
+#include "uint128.h"
 
 /* -------------------------------
  * Helper: compare two polynomials
@@ -83,6 +87,319 @@ static void test_multiplication(void **state)
     free_polynomial(&prod);
 }
 
+/* -------------------------------
+ * Test multiplication above the Karatsuba threshold,
+ * balanced and unbalanced, against the schoolbook product
+ * ------------------------------- */
+static void assert_product_matches_schoolbook(int degree1, int degree2)
+{
+    double *coeffs1 = malloc((degree1 + 1) * sizeof(double));
+    double *coeffs2 = malloc((degree2 + 1) * sizeof(double));
+    double *expected = calloc(degree1 + degree2 + 1, sizeof(double));
+
+    // small integers keep every partial sum exact, so both methods must agree exactly
+    for (int i = 0; i <= degree1; i++)
+        coeffs1[i] = (i % 7) - 3.0;
+    for (int j = 0; j <= degree2; j++)
+        coeffs2[j] = (j % 5) - 2.0;
+    coeffs1[degree1] = 1.0;
+    coeffs2[degree2] = 1.0;
+
+    for (int i = 0; i <= degree1; i++)
+        for (int j = 0; j <= degree2; j++)
+            expected[i + j] += coeffs1[i] * coeffs2[j];
+
+    Polynomial p1 = {.degree = degree1, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = degree2, .coefficients = coeffs2};
+
+    Polynomial prod = polynomial_multiply(&p1, &p2);
+
+    assert_int_equal(prod.degree, degree1 + degree2);
+    for (int i = 0; i <= prod.degree; i++)
+        assert_true(prod.coefficients[i] == expected[i]);
+
+    free_polynomial(&prod);
+    free(coeffs1);
+    free(coeffs2);
+    free(expected);
+}
+
+static void test_multiplication_karatsuba(void **state)
+{
+    (void)state;
+
+    assert_product_matches_schoolbook(300, 300);
+    assert_product_matches_schoolbook(300, 100);
+    assert_product_matches_schoolbook(40, 250);
+}
+
+/* -------------------------------
+ * Test Karatsuba accuracy with non-integer coefficients whose
+ * low halves are scaled down by 1e-12: the error of every
+ * product coefficient stays within n u of the largest one
+ * ------------------------------- */
+static void test_multiplication_karatsuba_accuracy(void **state)
+{
+    (void)state;
+
+    int degree = 300;
+    int low = degree / 2;
+
+    double *coeffs1 = malloc((degree + 1) * sizeof(double));
+    double *coeffs2 = malloc((degree + 1) * sizeof(double));
+    double *expected = calloc(2 * degree + 1, sizeof(double));
+    double *magnitude = calloc(2 * degree + 1, sizeof(double));
+
+    for (int i = 0; i <= degree; i++)
+    {
+        double scale = (i < low) ? 1e-12 : 1.0;
+        coeffs1[i] = scale * cos(0.7 * i);
+        coeffs2[i] = scale * sin(1.3 * i + 0.5);
+    }
+
+    for (int i = 0; i <= degree; i++)
+        for (int j = 0; j <= degree; j++)
+        {
+            expected[i + j] += coeffs1[i] * coeffs2[j];
+            magnitude[i + j] += fabs(coeffs1[i] * coeffs2[j]);
+        }
+
+    double largest = 0.0;
+    for (int k = 0; k <= 2 * degree; k++)
+        largest = fmax(largest, magnitude[k]);
+
+    Polynomial p1 = {.degree = degree, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = degree, .coefficients = coeffs2};
+
+    Polynomial prod = polynomial_multiply(&p1, &p2);
+
+    // the reference carries up to n u of its own error
+    double bound = 2.0 * (degree + 1) * DBL_EPSILON * largest;
+
+    assert_int_equal(prod.degree, 2 * degree);
+    for (int k = 0; k <= prod.degree; k++)
+        assert_true(fabs(prod.coefficients[k] - expected[k]) <= bound);
+
+    free_polynomial(&prod);
+    free(coeffs1);
+    free(coeffs2);
+    free(expected);
+    free(magnitude);
+}
+
+/* -------------------------------
+ * Test multiplication above the FFT threshold: the low halves
+ * are scaled down by 1e-12, and the product coefficients built
+ * only from them must keep their own relative accuracy
+ * ------------------------------- */
+static void test_multiplication_fft(void **state)
+{
+    (void)state;
+
+    int degree = 2500;
+    int low = degree / 2;
+
+    double *coeffs1 = malloc((degree + 1) * sizeof(double));
+    double *coeffs2 = malloc((degree + 1) * sizeof(double));
+    double *expected = calloc(2 * degree + 1, sizeof(double));
+    double *magnitude = calloc(2 * degree + 1, sizeof(double));
+
+    for (int i = 0; i <= degree; i++)
+    {
+        double scale = (i < low) ? 1e-12 : 1.0;
+        coeffs1[i] = scale * cos(0.7 * i);
+        coeffs2[i] = scale * sin(1.3 * i + 0.5);
+    }
+
+    for (int i = 0; i <= degree; i++)
+        for (int j = 0; j <= degree; j++)
+        {
+            expected[i + j] += coeffs1[i] * coeffs2[j];
+            magnitude[i + j] += fabs(coeffs1[i] * coeffs2[j]);
+        }
+
+    double largest = 0.0;
+    for (int k = 0; k <= 2 * degree; k++)
+        largest = fmax(largest, magnitude[k]);
+
+    Polynomial p1 = {.degree = degree, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = degree, .coefficients = coeffs2};
+
+    Polynomial prod = polynomial_multiply(&p1, &p2);
+
+    assert_int_equal(prod.degree, 2 * degree);
+    for (int k = 0; k <= prod.degree; k++)
+    {
+        double scale = (k < low) ? magnitude[k] : largest;
+        assert_true(fabs(prod.coefficients[k] - expected[k]) <= 1e-12 * scale);
+    }
+
+    free_polynomial(&prod);
+    free(coeffs1);
+    free(coeffs2);
+    free(expected);
+    free(magnitude);
+}
+
+/* -------------------------------
+ * Test multiplication above the FFT threshold with coefficients
+ * spanning 100 binary orders, more than the FFT bands cover:
+ * every product coefficient keeps its own relative accuracy
+ * ------------------------------- */
+static void test_multiplication_fft_wide_range(void **state)
+{
+    (void)state;
+
+    int degree = 2500;
+
+    double *coeffs1 = malloc((degree + 1) * sizeof(double));
+    double *coeffs2 = malloc((degree + 1) * sizeof(double));
+    double *expected = calloc(2 * degree + 1, sizeof(double));
+    double *magnitude = calloc(2 * degree + 1, sizeof(double));
+
+    // five tiers, 2^-100 at the low end up to 1 at the high end
+    for (int i = 0; i <= degree; i++)
+    {
+        int tier = 5 * i / (degree + 1);
+        coeffs1[i] = ldexp(cos(0.7 * i), -25 * (4 - tier));
+        coeffs2[i] = ldexp(sin(1.3 * i + 0.5), -25 * (4 - tier));
+    }
+
+    for (int i = 0; i <= degree; i++)
+        for (int j = 0; j <= degree; j++)
+        {
+            expected[i + j] += coeffs1[i] * coeffs2[j];
+            magnitude[i + j] += fabs(coeffs1[i] * coeffs2[j]);
+        }
+
+    Polynomial p1 = {.degree = degree, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = degree, .coefficients = coeffs2};
+
+    Polynomial prod = polynomial_multiply(&p1, &p2);
+
+    assert_int_equal(prod.degree, 2 * degree);
+    for (int k = 0; k <= prod.degree; k++)
+        assert_true(fabs(prod.coefficients[k] - expected[k]) <= 1e-12 * magnitude[k]);
+
+    free_polynomial(&prod);
+    free(coeffs1);
+    free(coeffs2);
+    free(expected);
+    free(magnitude);
+}
+
+/* -------------------------------
+ * Test exact multiplication of integer polynomials whose
+ * products need one and two NTT primes, against a 128-bit
+ * integer reference
+ * ------------------------------- */
+// a * b in two's complement, so signed sums wrap correctly
+static Uint128 signed_product(int64_t a, int64_t b)
+{
+    uint64_t a_magnitude = (a < 0) ? 0 - (uint64_t)a : (uint64_t)a;
+    uint64_t b_magnitude = (b < 0) ? 0 - (uint64_t)b : (uint64_t)b;
+
+    Uint128 product = uint128_multiply(a_magnitude, b_magnitude);
+
+    return ((a < 0) != (b < 0)) ? uint128_subtract((Uint128){0, 0}, product) : product;
+}
+
+static double signed_to_double(Uint128 x)
+{
+    if (x.high >> 63)
+        return -uint128_to_double(uint128_subtract((Uint128){0, 0}, x));
+
+    return uint128_to_double(x);
+}
+
+static void assert_integer_product_exact(int degree, int bits)
+{
+    double *coeffs1 = malloc((degree + 1) * sizeof(double));
+    double *coeffs2 = malloc((degree + 1) * sizeof(double));
+    Uint128 *expected = calloc(2 * degree + 1, sizeof(Uint128));
+
+    int64_t range = (int64_t)1 << bits;
+    for (int i = 0; i <= degree; i++)
+    {
+        coeffs1[i] = (double)((i * 7919 + 13) % range - range / 2);
+        coeffs2[i] = (double)((i * 104729 + 7) % range - range / 2);
+    }
+
+    for (int i = 0; i <= degree; i++)
+        for (int j = 0; j <= degree; j++)
+            expected[i + j] = uint128_add(expected[i + j], signed_product((int64_t)coeffs1[i], (int64_t)coeffs2[j]));
+
+    Polynomial p1 = {.degree = degree, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = degree, .coefficients = coeffs2};
+
+    Polynomial prod = polynomial_multiply(&p1, &p2);
+
+    assert_int_equal(prod.degree, 2 * degree);
+    for (int k = 0; k <= prod.degree; k++)
+        assert_true(prod.coefficients[k] == signed_to_double(expected[k]));
+
+    free_polynomial(&prod);
+    free(coeffs1);
+    free(coeffs2);
+    free(expected);
+}
+
+static void test_multiplication_integer_exact(void **state)
+{
+    (void)state;
+
+    assert_integer_product_exact(400, 20);
+    assert_integer_product_exact(600, 40);
+}
+
+/* -------------------------------
+ * Test the in-place forms: a zero-initialised destination,
+ * aliased operands, and reuse of the allocation once it is
+ * large enough
+ * ------------------------------- */
+static void test_in_place_arithmetic(void **state)
+{
+    (void)state;
+
+    double coeffs1[] = {1.0, 1.0};        // x + 1
+    double coeffs2[] = {-1.0, 0.0, 1.0};  // x^2 - 1
+
+    Polynomial p1 = {.degree = 1, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = 2, .coefficients = coeffs2};
+
+    Polynomial dst = {0};
+
+    polynomial_multiply_into(&dst, &p1, &p2);
+    double expected_product[] = {-1.0, -1.0, 1.0, 1.0}; // x^3 + x^2 - x - 1
+    assert_polynomials_equal(&dst, expected_product, 3);
+
+    double *allocation = dst.coefficients;
+
+    polynomial_add_into(&dst, &p1, &p2);
+    double expected_sum[] = {0.0, 1.0, 1.0}; // x^2 + x
+    assert_polynomials_equal(&dst, expected_sum, 2);
+    assert_true(dst.coefficients == allocation);
+
+    polynomial_subtract_into(&dst, &dst, &p2);
+    double expected_difference[] = {1.0, 1.0}; // x + 1
+    assert_polynomials_equal(&dst, expected_difference, 1);
+
+    polynomial_multiply_into(&dst, &dst, &dst);
+    double expected_square[] = {1.0, 2.0, 1.0}; // (x + 1)^2
+    assert_polynomials_equal(&dst, expected_square, 2);
+
+    polynomial_scale_in_place(&dst, 3.0);
+    polynomial_derivative_into(&dst, &dst);
+    double expected_derivative[] = {6.0, 6.0}; // 6x + 6
+    assert_polynomials_equal(&dst, expected_derivative, 1);
+
+    polynomial_scale_in_place(&dst, 0.0);
+    double expected_zero[] = {0.0};
+    assert_polynomials_equal(&dst, expected_zero, 0);
+
+    free_polynomial(&dst);
+}
+
 /* -------------------------------
  * Test division: (x^2 - 1) / (x - 1) = x + 1, remainder = 0
  * ------------------------------- */
@@ -109,6 +426,422 @@ static void test_division(void **state)
     free_polynomial(&remainder);
 }
 
+/* -------------------------------
+ * Test division with a remainder: p1 = quotient * p2 + rest
+ * ------------------------------- */
+static void test_division_with_remainder(void **state)
+{
+    (void)state;
+
+    double coeffs1[41];
+    double coeffs2[] = {1.0, -0.5, 0.25, 0.5, -0.25, 0.5, 0.25, 4.0};
+
+    for (int i = 0; i <= 40; i++)
+        coeffs1[i] = cos(1.7 * i) * (1 + i % 3);
+
+    Polynomial p1 = {.degree = 40, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = 7, .coefficients = coeffs2};
+
+    Polynomial rest;
+    Polynomial quotient = polynomial_divide(&p1, &p2, &rest);
+
+    assert_int_equal(quotient.degree, 33);
+    assert_true(rest.degree < 7);
+
+    Polynomial product = polynomial_multiply(&quotient, &p2);
+    Polynomial rebuilt = polynomial_add(&product, &rest);
+
+    assert_polynomials_equal(&rebuilt, coeffs1, 40);
+
+    free_polynomial(&quotient);
+    free_polynomial(&rest);
+    free_polynomial(&product);
+    free_polynomial(&rebuilt);
+}
+
+/* -------------------------------
+ * Test synthetic division by linear and quadratic factors in
+ * both directions: (x - 4)(x^2 + x + 3)(x + 0.5)
+ * ------------------------------- */
+static void test_deflation(void **state)
+{
+    (void)state;
+
+    // (x - 4)(x^2 + x + 3) = x^3 - 3x^2 - x - 12, times (x + 0.5)
+    double coeffs[] = {-6.0, -12.5, -2.5, -2.5, 1.0};
+    double expected_cubic[] = {-12.0, -1.0, -3.0, 1.0};
+    double expected_quadratic[] = {3.0, 1.0, 1.0};
+    double expected_linear[] = {-4.0, 1.0};
+
+    DeflationDirection directions[] = {DEFLATION_FORWARD, DEFLATION_BACKWARD, DEFLATION_AUTO};
+
+    for (int d = 0; d < 3; d++)
+    {
+        Polynomial p = create_polynomial(coeffs, 4);
+
+        double left_over = polynomial_deflate_linear(&p, -0.5, directions[d]);
+        assert_float_equal(left_over, 0.0, 1e-12);
+        assert_polynomials_equal(&p, expected_cubic, 3);
+
+        double quadratic_left_over[2];
+        polynomial_deflate_quadratic(&p, 1.0, 3.0, directions[d], quadratic_left_over);
+        assert_float_equal(quadratic_left_over[0], 0.0, 1e-12);
+        assert_float_equal(quadratic_left_over[1], 0.0, 1e-12);
+        assert_polynomials_equal(&p, expected_linear, 1);
+        free_polynomial(&p);
+
+        p = create_polynomial(expected_cubic, 3);
+        left_over = polynomial_deflate_linear(&p, 4.0, directions[d]);
+        assert_float_equal(left_over, 0.0, 1e-12);
+        assert_polynomials_equal(&p, expected_quadratic, 2);
+        free_polynomial(&p);
+    }
+
+    // forward leaves the ordinary remainder p(root)
+    Polynomial p = create_polynomial(expected_cubic, 3);
+    double remainder = polynomial_deflate_linear(&p, 1.0, DEFLATION_FORWARD);
+    assert_float_equal(remainder, -15.0, 1e-12);
+    free_polynomial(&p);
+}
+
+/* -------------------------------
+ * Test division above the Newton threshold: p1 is rebuilt
+ * from quotient * p2 + rest
+ * ------------------------------- */
+static void test_division_newton(void **state)
+{
+    (void)state;
+
+    int degree2 = 8200;
+    int degree1 = 2 * degree2;
+
+    double *coeffs1 = malloc((degree1 + 1) * sizeof(double));
+    double *coeffs2 = malloc((degree2 + 1) * sizeof(double));
+
+    for (int i = 0; i <= degree1; i++)
+        coeffs1[i] = cos(0.3 * i);
+
+    // a dominant leading coefficient keeps the quotient's coefficients bounded
+    for (int j = 0; j < degree2; j++)
+        coeffs2[j] = 1e-4 * sin(0.7 * j);
+    coeffs2[degree2] = 1.0;
+
+    Polynomial p1 = {.degree = degree1, .coefficients = coeffs1};
+    Polynomial p2 = {.degree = degree2, .coefficients = coeffs2};
+
+    Polynomial rest;
+    Polynomial quotient = polynomial_divide(&p1, &p2, &rest);
+
+    assert_int_equal(quotient.degree, degree1 - degree2);
+    assert_true(rest.degree < degree2);
+
+    Polynomial product = polynomial_multiply(&quotient, &p2);
+    Polynomial rebuilt = polynomial_add(&product, &rest);
+
+    assert_int_equal(rebuilt.degree, degree1);
+    for (int i = 0; i <= degree1; i++)
+        assert_true(fabs(rebuilt.coefficients[i] - coeffs1[i]) < 1e-9);
+
+    free_polynomial(&quotient);
+    free_polynomial(&rest);
+    free_polynomial(&product);
+    free_polynomial(&rebuilt);
+    free(coeffs1);
+    free(coeffs2);
+}
+
+/* -------------------------------
+ * Test gcd: primitive integer gcd, monic gcd of real
+ * polynomials, and gcd with zero
+ * ------------------------------- */
+static void test_gcd(void **state)
+{
+    (void)state;
+
+    // (2x - 1)(x + 3)^2 and 6 (x + 3)(x^2 + 1): exact primitive gcd x + 3
+    double a_coeffs[] = {-9.0, 12.0, 11.0, 2.0};
+    double b_coeffs[] = {18.0, 6.0, 18.0, 6.0};
+    double expected_integer[] = {3.0, 1.0};
+
+    Polynomial a = create_polynomial(a_coeffs, 3);
+    Polynomial b = create_polynomial(b_coeffs, 3);
+
+    Polynomial g = polynomial_gcd(&a, &b);
+    assert_polynomials_equal(&g, expected_integer, 1);
+    free_polynomial(&g);
+
+    // gcd(p, 0) is p made primitive
+    Polynomial zero = create_zero_polynomial();
+    double expected_self[] = {3.0, 1.0, 3.0, 1.0};
+
+    g = polynomial_gcd(&zero, &b);
+    assert_polynomials_equal(&g, expected_self, 3);
+    free_polynomial(&g);
+
+    // coprime operands
+    double c_coeffs[] = {1.0, 0.0, 1.0};
+    double expected_one[] = {1.0};
+
+    Polynomial c = create_polynomial(c_coeffs, 2);
+
+    g = polynomial_gcd(&a, &c);
+    assert_polynomials_equal(&g, expected_one, 0);
+    free_polynomial(&g);
+
+    // 0.1 (x - 0.5)(x - 1.5) and 30 (x - 0.5)(x + 2.25): monic gcd x - 0.5
+    double d_coeffs[] = {0.075, -0.2, 0.1};
+    double e_coeffs[] = {-33.75, 52.5, 30.0};
+    double expected_float[] = {-0.5, 1.0};
+
+    Polynomial d = create_polynomial(d_coeffs, 2);
+    Polynomial e = create_polynomial(e_coeffs, 2);
+
+    g = polynomial_gcd(&d, &e);
+    assert_polynomials_equal(&g, expected_float, 1);
+    free_polynomial(&g);
+
+    free_polynomial(&a);
+    free_polynomial(&b);
+    free_polynomial(&c);
+    free_polynomial(&d);
+    free_polynomial(&e);
+    free_polynomial(&zero);
+}
+
+/* -------------------------------
+ * Test square-free decomposition:
+ * 2 (x - 1)(x^2 - 2)^2 (x + 3)^3
+ * ------------------------------- */
+static void test_square_free_decomposition(void **state)
+{
+    (void)state;
+
+    // 2 (x - 1)(x^2 - 2)^2 (x + 3)^3
+    double factor_coeffs[][4] = {{-1.0, 1.0}, {-2.0, 0.0, 1.0}, {3.0, 1.0}};
+    int factor_degrees[] = {1, 2, 1};
+
+    Polynomial p = create_monomial(0, 2.0);
+
+    for (int f = 0; f < 3; f++)
+    {
+        Polynomial factor = create_polynomial(factor_coeffs[f], factor_degrees[f]);
+
+        for (int k = 0; k <= f; k++)
+            polynomial_multiply_into(&p, &p, &factor);
+
+        free_polynomial(&factor);
+    }
+
+    SquareFreeDecomposition d = polynomial_square_free_decomposition(&p);
+
+    assert_int_equal(d.count, 3);
+
+    for (int f = 0; f < 3; f++)
+    {
+        assert_int_equal(d.factors[f].multiplicity, f + 1);
+        assert_polynomials_equal(&d.factors[f].factor, factor_coeffs[f], factor_degrees[f]);
+    }
+
+    free_square_free_decomposition(&d);
+
+    // the same with non-integer coefficients: factors come out monic
+    polynomial_scale_in_place(&p, 0.3);
+
+    d = polynomial_square_free_decomposition(&p);
+
+    assert_int_equal(d.count, 3);
+
+    for (int f = 0; f < 3; f++)
+    {
+        assert_int_equal(d.factors[f].multiplicity, f + 1);
+        assert_polynomials_equal(&d.factors[f].factor, factor_coeffs[f], factor_degrees[f]);
+    }
+
+    free_square_free_decomposition(&d);
+    free_polynomial(&p);
+}
+
+/* -------------------------------
+ * Test composition: (x^2 + 1) o (2x - 3) and
+ * compositions long enough to split p
+ * ------------------------------- */
+static void test_compose(void **state)
+{
+    (void)state;
+
+    // (x^2 + 1) o (2x - 3) = 4x^2 - 12x + 10
+    double p_coeffs[] = {1.0, 0.0, 1.0};
+    double q_coeffs[] = {-3.0, 2.0};
+    double expected[] = {10.0, -12.0, 4.0};
+
+    Polynomial p = create_polynomial(p_coeffs, 2);
+    Polynomial q = create_polynomial(q_coeffs, 1);
+
+    Polynomial r = polynomial_compose(&p, &q);
+    assert_polynomials_equal(&r, expected, 2);
+    free_polynomial(&r);
+
+    free_polynomial(&p);
+    free_polynomial(&q);
+
+    // long p takes the split path; compare with p evaluated at q(x)
+    int degree = 150;
+    double *coeffs = malloc((degree + 1) * sizeof(double));
+    for (int i = 0; i <= degree; i++)
+        coeffs[i] = ((i * 37) % 19 - 9) / 9.0;
+
+    double inner[] = {0.1, -0.4, 0.3};
+
+    p = create_polynomial(coeffs, degree);
+    q = create_polynomial(inner, 2);
+    r = polynomial_compose(&p, &q);
+
+    assert_int_equal(r.degree, 2 * degree);
+
+    for (double x = -1.0; x <= 1.0; x += 0.125)
+    {
+        double y = polynomial_evaluate(&q, x);
+
+        // rounding scales with p and q taken in absolute values
+        double y_magnitude = fabs(inner[0]) + fabs(inner[1] * x) + fabs(inner[2] * x * x);
+        double magnitude = 0.0;
+        for (int i = degree; i >= 0; i--)
+            magnitude = magnitude * y_magnitude + fabs(coeffs[i]);
+
+        assert_float_equal(polynomial_evaluate(&r, x), polynomial_evaluate(&p, y), 1e-12 * magnitude);
+    }
+
+    free_polynomial(&r);
+    free_polynomial(&p);
+    free_polynomial(&q);
+    free(coeffs);
+}
+
+/* -------------------------------
+ * Test Taylor shifts: x^3 shifted by 1, and a long
+ * p shifted by -0.25 against evaluation at x - 0.25
+ * ------------------------------- */
+static void test_taylor_shift(void **state)
+{
+    (void)state;
+
+    // (x + 1)^3
+    double cube[] = {0.0, 0.0, 0.0, 1.0};
+    double expected[] = {1.0, 3.0, 3.0, 1.0};
+
+    Polynomial p = create_polynomial(cube, 3);
+    Polynomial r = polynomial_taylor_shift(&p, 1.0);
+    assert_polynomials_equal(&r, expected, 3);
+    free_polynomial(&r);
+    free_polynomial(&p);
+
+    // long p takes the split path
+    int degree = 300;
+    double *coeffs = malloc((degree + 1) * sizeof(double));
+    for (int i = 0; i <= degree; i++)
+        coeffs[i] = ((i * 53) % 23 - 11) / 11.0;
+
+    p = create_polynomial(coeffs, degree);
+    r = polynomial_taylor_shift(&p, -0.25);
+
+    assert_int_equal(r.degree, degree);
+
+    for (double x = -0.5; x <= 0.5; x += 0.125)
+    {
+        double magnitude = 0.0;
+        for (int i = degree; i >= 0; i--)
+            magnitude = magnitude * (fabs(x) + 0.25) + fabs(coeffs[i]);
+
+        assert_float_equal(polynomial_evaluate(&r, x), polynomial_evaluate(&p, x - 0.25), 1e-12 * magnitude);
+    }
+
+    free_polynomial(&r);
+    free_polynomial(&p);
+    free(coeffs);
+}
+
+/* -------------------------------
+ * Test powers: (x - 1)^50 and (x + 2)^30 against
+ * the binomial expansion, truncated and small powers
+ * ------------------------------- */
+static void test_pow(void **state)
+{
+    (void)state;
+
+    // (x - 1)^50 (x + 2)^30, checked against the binomial expansion of each power
+    double x_minus_one[] = {-1.0, 1.0};
+    double x_plus_two[] = {2.0, 1.0};
+
+    Polynomial a = create_polynomial(x_minus_one, 1);
+    Polynomial b = create_polynomial(x_plus_two, 1);
+
+    Polynomial a50 = polynomial_pow(&a, 50);
+    Polynomial b30 = polynomial_pow(&b, 30);
+
+    assert_int_equal(a50.degree, 50);
+    assert_int_equal(b30.degree, 30);
+
+    double binomial = 1.0;
+    for (int i = 0; i <= 50; i++)
+    {
+        assert_true(a50.coefficients[i] == (((50 - i) % 2) ? -binomial : binomial));
+        binomial = binomial * (50 - i) / (i + 1);
+    }
+
+    binomial = 1.0;
+    for (int i = 0; i <= 30; i++)
+    {
+        assert_true(b30.coefficients[i] == binomial * ldexp(1.0, 30 - i));
+        binomial = binomial * (30 - i) / (i + 1);
+    }
+
+    Polynomial product = polynomial_multiply(&a50, &b30);
+    assert_int_equal(product.degree, 80);
+    assert_true(product.coefficients[80] == 1.0);
+    assert_true(product.coefficients[0] == ldexp(1.0, 30));
+    free_polynomial(&product);
+
+    // truncation keeps the low terms of (x + 2)^30
+    Polynomial low = polynomial_pow_truncated(&b, 30, 4);
+    assert_polynomials_equal(&low, b30.coefficients, 4);
+    free_polynomial(&low);
+
+    // k = 0 and k = 1
+    double one[] = {1.0};
+    Polynomial zeroth = polynomial_pow(&a, 0);
+    assert_polynomials_equal(&zeroth, one, 0);
+    free_polynomial(&zeroth);
+
+    Polynomial first = polynomial_pow(&a, 1);
+    assert_polynomials_equal(&first, x_minus_one, 1);
+    free_polynomial(&first);
+
+    // negative powers are rejected rather than looping
+    double zero[] = {0.0};
+    Polynomial negative = polynomial_pow(&a, -3);
+    assert_polynomials_equal(&negative, zero, 0);
+    free_polynomial(&negative);
+
+    // non-integer base against repeated multiplication
+    double c_coeffs[] = {0.25, -0.5, 0.75};
+    Polynomial c = create_polynomial(c_coeffs, 2);
+    Polynomial expected = create_monomial(0, 1.0);
+
+    for (int i = 0; i < 7; i++)
+        polynomial_multiply_into(&expected, &expected, &c);
+
+    Polynomial c7 = polynomial_pow(&c, 7);
+    assert_polynomials_equal(&c7, expected.coefficients, 14);
+
+    free_polynomial(&c7);
+    free_polynomial(&expected);
+    free_polynomial(&c);
+    free_polynomial(&a50);
+    free_polynomial(&b30);
+    free_polynomial(&a);
+    free_polynomial(&b);
+}
+
 /* -------------------------------
  * Test runner
  * ------------------------------- */
@@ -118,7 +851,21 @@ int main(void)
         cmocka_unit_test(test_addition),
         cmocka_unit_test(test_subtraction),
         cmocka_unit_test(test_multiplication),
+        cmocka_unit_test(test_multiplication_karatsuba),
+        cmocka_unit_test(test_multiplication_karatsuba_accuracy),
+        cmocka_unit_test(test_multiplication_fft),
+        cmocka_unit_test(test_multiplication_fft_wide_range),
+        cmocka_unit_test(test_multiplication_integer_exact),
+        cmocka_unit_test(test_in_place_arithmetic),
         cmocka_unit_test(test_division),
+        cmocka_unit_test(test_division_with_remainder),
+        cmocka_unit_test(test_division_newton),
+        cmocka_unit_test(test_deflation),
+        cmocka_unit_test(test_gcd),
+        cmocka_unit_test(test_square_free_decomposition),
+        cmocka_unit_test(test_compose),
+        cmocka_unit_test(test_taylor_shift),
+        cmocka_unit_test(test_pow),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,383 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include "polynomial.h"
+#include "polynomial_batch.h"
+
+#define SAMPLE_COUNT 37
+
+/* ---------------------------------------
+ * Helpers
+ * --------------------------------------- */
+static Polynomial make_poly(int degree, double *coeffs)
+{
+    Polynomial p;
+    p.degree = degree;
+    p.coefficients = coeffs;
+    return p;
+}
+
+static void fill_samples(double *xs, size_t n, double from, double to)
+{
+    for (size_t i = 0; i < n; i++)
+        xs[i] = from + (to - from) * (double)i / (double)(n - 1);
+}
+
+/* Rounding error bound of Horner's scheme: gamma(2n) * sum |c_i| |x|^i,
+ * doubled because both the SIMD and the reference result carry it. */
+static double horner_error_bound(const Polynomial *p, double x)
+{
+    double magnitude = 0.0;
+    for (int i = p->degree; i >= 0; i--)
+        magnitude = magnitude * fabs(x) + fabs(p->coefficients[i]);
+
+    double u = DBL_EPSILON / 2.0;
+    double gamma = 2.0 * p->degree * u / (1.0 - 2.0 * p->degree * u);
+
+    return 2.0 * gamma * magnitude + DBL_MIN;
+}
+
+static void assert_levels_match_reference(const Polynomial *p, const double *xs, size_t n)
+{
+    double reference[SAMPLE_COUNT];
+    double ys[SAMPLE_COUNT];
+
+    polynomial_evaluate_many_at_level(p, xs, reference, n, SIMD_LEVEL_SCALAR);
+
+    for (size_t i = 0; i < n; i++)
+        assert_true(reference[i] == polynomial_evaluate_with_scheme(p, xs[i], EVALUATION_HORNER));
+
+    for (int level = SIMD_LEVEL_SSE2; level <= SIMD_LEVEL_AVX512; level++)
+    {
+        polynomial_evaluate_many_at_level(p, xs, ys, n, (SimdLevel)level);
+
+        for (size_t i = 0; i < n; i++)
+            assert_true(fabs(ys[i] - reference[i]) <= horner_error_bound(p, xs[i]));
+    }
+}
+
+/* ---------------------------------------
+ * polynomial_evaluate_many tests
+ * --------------------------------------- */
+
+static void test_many_matches_scalar(void **state)
+{
+    (void)state;
+
+    double c[] = {-1.0, 0.0, 1.0}; // x^2 - 1
+    Polynomial p = make_poly(2, c);
+
+    double xs[SAMPLE_COUNT];
+    double ys[SAMPLE_COUNT];
+    fill_samples(xs, SAMPLE_COUNT, -3.0, 3.0);
+
+    polynomial_evaluate_many(&p, xs, ys, SAMPLE_COUNT);
+
+    for (size_t i = 0; i < SAMPLE_COUNT; i++)
+        assert_float_equal(ys[i], xs[i] * xs[i] - 1.0, 1e-12);
+}
+
+static void test_many_levels_within_ulp_bound(void **state)
+{
+    (void)state;
+
+    double c[] = {0.5, -3.0, 2.25, 7.0, -1.0, 0.125, -4.0, 1.0, 3.0, -0.75};
+    Polynomial p = make_poly(9, c);
+
+    double xs[SAMPLE_COUNT];
+    fill_samples(xs, SAMPLE_COUNT, -2.5, 2.5);
+
+    assert_levels_match_reference(&p, xs, SAMPLE_COUNT);
+}
+
+static void test_many_levels_above_kernel_degree(void **state)
+{
+    (void)state;
+
+    // past the unrolled kernels, where the scalar tails run their own Horner loop
+    double c[25];
+    for (int i = 0; i <= 24; i++)
+        c[i] = sin(i + 1.0);
+    Polynomial p = make_poly(24, c);
+
+    double xs[SAMPLE_COUNT];
+    fill_samples(xs, SAMPLE_COUNT, -1.25, 1.25);
+
+    assert_levels_match_reference(&p, xs, SAMPLE_COUNT);
+}
+
+static void test_many_levels_without_cancellation(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}; // positive terms for x > 0
+    Polynomial p = make_poly(5, c);
+
+    double xs[SAMPLE_COUNT];
+    double reference[SAMPLE_COUNT];
+    double ys[SAMPLE_COUNT];
+    fill_samples(xs, SAMPLE_COUNT, 0.1, 4.0);
+
+    polynomial_evaluate_many_at_level(&p, xs, reference, SAMPLE_COUNT, SIMD_LEVEL_SCALAR);
+
+    for (int level = SIMD_LEVEL_SSE2; level <= SIMD_LEVEL_AVX512; level++)
+    {
+        polynomial_evaluate_many_at_level(&p, xs, ys, SAMPLE_COUNT, (SimdLevel)level);
+
+        // at most 2 * degree ulps apart when no terms cancel
+        for (size_t i = 0; i < SAMPLE_COUNT; i++)
+            assert_true(fabs(ys[i] - reference[i]) <= 2.0 * p.degree * DBL_EPSILON * fabs(reference[i]));
+    }
+}
+
+static void test_many_constant_polynomial(void **state)
+{
+    (void)state;
+
+    double c[] = {5.0};
+    Polynomial p = make_poly(0, c);
+
+    double xs[SAMPLE_COUNT];
+    double ys[SAMPLE_COUNT];
+    fill_samples(xs, SAMPLE_COUNT, -10.0, 10.0);
+
+    polynomial_evaluate_many(&p, xs, ys, SAMPLE_COUNT);
+
+    for (size_t i = 0; i < SAMPLE_COUNT; i++)
+        assert_float_equal(ys[i], 5.0, 0.0);
+}
+
+static void test_many_empty_input(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, 1.0};
+    Polynomial p = make_poly(1, c);
+
+    double ys[1] = {42.0};
+
+    polynomial_evaluate_many(&p, NULL, ys, 0);
+
+    assert_float_equal(ys[0], 42.0, 0.0);
+}
+
+static void test_many_float_within_bound(void **state)
+{
+    (void)state;
+
+    double c[] = {0.5, -3.0, 2.25, 7.0, -1.0, 0.125, -4.0, 1.0, 3.0, -0.75};
+    Polynomial p = make_poly(9, c);
+
+    double xs[SAMPLE_COUNT];
+    double ys[SAMPLE_COUNT];
+    fill_samples(xs, SAMPLE_COUNT, -2.5, 2.5);
+
+    double bound = polynomial_evaluate_many_float(&p, xs, ys, SAMPLE_COUNT);
+
+    // float precision, but nowhere near double
+    assert_true(bound > 1e-9 && bound < 1.0);
+
+    for (size_t i = 0; i < SAMPLE_COUNT; i++)
+        assert_true(fabs(ys[i] - polynomial_evaluate(&p, xs[i])) <= bound);
+}
+
+static void test_many_float_underflow(void **state)
+{
+    (void)state;
+
+    // coefficients subnormal in float, far from the origin
+    double linear[] = {0.0, 1e-40};
+    double quadratic[] = {0.0, 0.0, 3e-45};
+    double xs[] = {1e30, 1e18, -1e-3};
+    double ys[3];
+
+    Polynomial p = make_poly(1, linear);
+    double bound = polynomial_evaluate_many_float(&p, xs, ys, 3);
+
+    for (size_t i = 0; i < 3; i++)
+        assert_true(fabs(ys[i] - polynomial_evaluate(&p, xs[i])) <= bound);
+
+    Polynomial q = make_poly(2, quadratic);
+    bound = polynomial_evaluate_many_float(&q, xs, ys, 3);
+
+    for (size_t i = 0; i < 3; i++)
+        assert_true(fabs(ys[i] - polynomial_evaluate(&q, xs[i])) <= bound);
+
+    // normal coefficients whose partial sums underflow at small x
+    double small[] = {1e-37, 1e-30, 1e-30};
+    double tiny_xs[] = {1e-10, -3e-9, 0.0};
+
+    Polynomial r = make_poly(2, small);
+    bound = polynomial_evaluate_many_float(&r, tiny_xs, ys, 3);
+
+    for (size_t i = 0; i < 3; i++)
+        assert_true(fabs(ys[i] - polynomial_evaluate(&r, tiny_xs[i])) <= bound);
+}
+
+static void test_many_float_out_of_range(void **state)
+{
+    (void)state;
+
+    double c[] = {1e300, 1.0}; // beyond float, evaluated in double instead
+    Polynomial p = make_poly(1, c);
+
+    double xs[] = {-1.0, 0.0, 2.0};
+    double ys[3];
+
+    double bound = polynomial_evaluate_many_float(&p, xs, ys, 3);
+
+    for (size_t i = 0; i < 3; i++)
+        assert_true(ys[i] == polynomial_evaluate(&p, xs[i]));
+    assert_true(bound <= 1e300 * 1e-14);
+}
+
+/* ---------------------------------------
+ * polynomial_evaluate_grid tests
+ * --------------------------------------- */
+
+static void assert_grid_matches_horner(const Polynomial *p, double x0, double dx, size_t n)
+{
+    double *ys = malloc(n * sizeof(double));
+
+    polynomial_evaluate_grid(p, x0, dx, n, ys);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        double x = x0 + i * dx;
+        assert_true(fabs(ys[i] - polynomial_evaluate(p, x)) <= 8.0 * horner_error_bound(p, x));
+    }
+
+    free(ys);
+}
+
+static void test_grid_cubic(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, -2.0, 0.5, 3.0};
+    Polynomial p = make_poly(3, c);
+
+    assert_grid_matches_horner(&p, -2.0, 1e-3, 4000);
+}
+
+static void test_grid_resynchronises_high_degree(void **state)
+{
+    (void)state;
+
+    double c[13];
+    for (int i = 0; i <= 12; i++)
+        c[i] = cos(i + 1.0);
+    Polynomial p = make_poly(12, c);
+
+    assert_grid_matches_horner(&p, -1.5, 3.0 / 5000, 5000);
+}
+
+static void test_grid_short_and_linear(void **state)
+{
+    (void)state;
+
+    double quadratic[] = {-1.0, 0.0, 1.0};
+    Polynomial q = make_poly(2, quadratic);
+    assert_grid_matches_horner(&q, 0.0, 0.25, 5);
+
+    double linear[] = {1.0, 2.0};
+    Polynomial l = make_poly(1, linear);
+    assert_grid_matches_horner(&l, -1.0, 0.5, 100);
+}
+
+/* ---------------------------------------
+ * polynomial_batch_evaluate tests
+ * --------------------------------------- */
+
+static void test_batch_matches_horner(void **state)
+{
+    (void)state;
+
+    // mixed degrees exercise the zero padding and a partial row block
+    enum { COUNT = 7, POINTS = 300 };
+    double coefficients[COUNT][9];
+    Polynomial polynomials[COUNT];
+
+    for (int i = 0; i < COUNT; i++)
+    {
+        for (int j = 0; j <= i + 2; j++)
+            coefficients[i][j] = sin(i * 9.0 + j + 1.0);
+        polynomials[i] = make_poly(i + 2, coefficients[i]);
+    }
+
+    double *xs = malloc(POINTS * sizeof(double));
+    double *out = malloc(COUNT * POINTS * sizeof(double));
+    fill_samples(xs, POINTS, -1.5, 1.5);
+
+    PolynomialBatch batch = create_polynomial_batch(polynomials, COUNT);
+    assert_int_equal(batch.max_degree, COUNT + 1);
+
+    polynomial_batch_evaluate(&batch, xs, POINTS, out);
+
+    for (int i = 0; i < COUNT; i++)
+        for (size_t k = 0; k < POINTS; k++)
+            assert_true(fabs(out[i * POINTS + k] - polynomial_evaluate(&polynomials[i], xs[k])) <=
+                        2.0 * horner_error_bound(&polynomials[i], xs[k]));
+
+    free_polynomial_batch(&batch);
+    free(xs);
+    free(out);
+}
+
+static void test_batch_constant_and_empty(void **state)
+{
+    (void)state;
+
+    double c[] = {3.0};
+    Polynomial p = make_poly(0, c);
+
+    double xs[] = {-1.0, 0.0, 2.0};
+    double out[3];
+
+    PolynomialBatch batch = create_polynomial_batch(&p, 1);
+    polynomial_batch_evaluate(&batch, xs, 3, out);
+
+    for (int k = 0; k < 3; k++)
+        assert_float_equal(out[k], 3.0, 0.0);
+
+    out[0] = 42.0;
+    polynomial_batch_evaluate(&batch, xs, 0, out);
+    assert_float_equal(out[0], 42.0, 0.0);
+
+    free_polynomial_batch(&batch);
+}
+
+/* ---------------------------------------
+ * Test runner
+ * --------------------------------------- */
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_many_matches_scalar),
+        cmocka_unit_test(test_many_levels_within_ulp_bound),
+        cmocka_unit_test(test_many_levels_above_kernel_degree),
+        cmocka_unit_test(test_many_levels_without_cancellation),
+        cmocka_unit_test(test_many_constant_polynomial),
+        cmocka_unit_test(test_many_empty_input),
+        cmocka_unit_test(test_many_float_within_bound),
+        cmocka_unit_test(test_many_float_underflow),
+        cmocka_unit_test(test_many_float_out_of_range),
+
+
+        cmocka_unit_test(test_grid_cubic),
+        cmocka_unit_test(test_grid_resynchronises_high_degree),
+        cmocka_unit_test(test_grid_short_and_linear),
+
+        cmocka_unit_test(test_batch_matches_horner),
+        cmocka_unit_test(test_batch_constant_and_empty),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
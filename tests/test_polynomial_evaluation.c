@@ -1,6 +1,7 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <setjmp.h>
+#include <math.h>
 #include <cmocka.h>
 
 #include "polynomial.h"
@@ -71,6 +72,243 @@ static void test_value_zero_polynomial(void **state)
     assert_float_equal(polynomial_evaluate(&p, 100.0), 0.0, 1e-9);
 }
 
+static void test_value_high_degree(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0}; // 1 - x + x^2 - ... + x^6
+    Polynomial p = make_poly(6, c);
+
+    assert_float_equal(polynomial_evaluate(&p, 2.0), 43.0, 1e-9);
+    assert_float_equal(polynomial_evaluate(&p, -1.0), 7.0, 1e-9);
+}
+
+/* ---------------------------------------
+ * polynomial_evaluate_with_scheme tests
+ * --------------------------------------- */
+
+static void test_estrin_matches_horner_high_degree(void **state)
+{
+    (void)state;
+
+    double c[31];
+    for (int i = 0; i <= 30; i++)
+        c[i] = (i % 2 == 0 ? 1.0 : -1.0) / (i + 1);
+    Polynomial p = make_poly(30, c);
+
+    for (double x = -1.2; x <= 1.2; x += 0.1)
+    {
+        double horner = polynomial_evaluate_with_scheme(&p, x, EVALUATION_HORNER);
+        double estrin = polynomial_evaluate_with_scheme(&p, x, EVALUATION_ESTRIN);
+
+        assert_float_equal(estrin, horner, 1e-12);
+    }
+}
+
+static void test_estrin_partial_block(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0}; // two blocks, second partial
+    Polynomial p = make_poly(9, c);
+
+    assert_float_equal(polynomial_evaluate_with_scheme(&p, 1.0, EVALUATION_ESTRIN), 55.0, 1e-12);
+    assert_float_equal(polynomial_evaluate_with_scheme(&p, -1.0, EVALUATION_ESTRIN), -5.0, 1e-12);
+}
+
+static void test_auto_scheme_selection(void **state)
+{
+    (void)state;
+
+    double c[31];
+    for (int i = 0; i <= 30; i++)
+        c[i] = 1.0 / (i + 1);
+
+    Polynomial low = make_poly(4, c);
+    Polynomial high = make_poly(30, c);
+
+    assert_true(polynomial_evaluate(&low, 0.7) == polynomial_evaluate_with_scheme(&low, 0.7, EVALUATION_HORNER));
+    assert_true(polynomial_evaluate(&high, 0.7) == polynomial_evaluate_with_scheme(&high, 0.7, EVALUATION_ESTRIN));
+}
+
+static void test_compensated_near_multiple_root(void **state)
+{
+    (void)state;
+
+    double c[] = {-1.0, 5.0, -10.0, 10.0, -5.0, 1.0}; // (x - 1)^5
+    Polynomial p = make_poly(5, c);
+
+    double x = 1.0 + 1e-4;
+    double exact = pow(x - 1.0, 5);
+
+    double compensated = polynomial_evaluate_with_scheme(&p, x, EVALUATION_COMPENSATED);
+
+    assert_float_equal(compensated, exact, 1e-9 * exact);
+}
+
+static void test_sign_at_clustered_roots(void **state)
+{
+    (void)state;
+
+    double c[] = {-1.0, 5.0, -10.0, 10.0, -5.0, 1.0}; // (x - 1)^5
+    Polynomial p = make_poly(5, c);
+
+    assert_int_equal(polynomial_sign_at(&p, 1.0 + 1e-4), 1);
+    assert_int_equal(polynomial_sign_at(&p, 1.0 - 1e-4), -1);
+    assert_int_equal(polynomial_sign_at(&p, 1.0), 0);
+    assert_int_equal(polynomial_sign_at(&p, 3.0), 1);
+}
+
+/* ---------------------------------------
+ * polynomial_evaluate_with_derivatives tests
+ * --------------------------------------- */
+
+static void test_derivatives_cubic(void **state)
+{
+    (void)state;
+
+    double c[] = {-1.0, 2.0, -3.0, 4.0}; // 4x^3 - 3x^2 + 2x - 1
+    Polynomial p = make_poly(3, c);
+
+    double out[5];
+    polynomial_evaluate_with_derivatives(&p, 2.0, 4, out);
+
+    assert_float_equal(out[0], 23.0, 1e-9); // p(2)
+    assert_float_equal(out[1], 38.0, 1e-9); // 12x^2 - 6x + 2
+    assert_float_equal(out[2], 42.0, 1e-9); // 24x - 6
+    assert_float_equal(out[3], 24.0, 1e-9);
+    assert_float_equal(out[4], 0.0, 1e-9);
+}
+
+static void test_derivatives_value_only(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, 2.0}; // 2x + 1
+    Polynomial p = make_poly(1, c);
+
+    double out[1];
+    polynomial_evaluate_with_derivatives(&p, -3.0, 0, out);
+
+    assert_float_equal(out[0], -5.0, 1e-9);
+}
+
+static void test_derivatives_constant(void **state)
+{
+    (void)state;
+
+    double c[] = {5.0};
+    Polynomial p = make_poly(0, c);
+
+    double out[3];
+    polynomial_evaluate_with_derivatives(&p, 10.0, 2, out);
+
+    assert_float_equal(out[0], 5.0, 1e-9);
+    assert_float_equal(out[1], 0.0, 1e-9);
+    assert_float_equal(out[2], 0.0, 1e-9);
+}
+
+static void test_unrolled_kernels_match_horner_loop(void **state)
+{
+    (void)state;
+
+    double c[41];
+    for (int i = 0; i <= 40; i++)
+        c[i] = sin(i + 1.0);
+
+    // covers every unrolled degree and the loops beyond both kernel tables
+    for (int degree = 0; degree <= 40; degree++)
+    {
+        Polynomial p = make_poly(degree, c);
+
+        for (double x = -1.25; x <= 1.25; x += 0.5)
+        {
+            double loop[3];
+            double first[2];
+
+            polynomial_evaluate_with_derivatives(&p, x, 2, loop);
+            polynomial_evaluate_with_derivatives(&p, x, 1, first);
+
+            assert_true(polynomial_evaluate_with_scheme(&p, x, EVALUATION_HORNER) == loop[0]);
+            assert_true(first[0] == loop[0]);
+            assert_true(first[1] == loop[1]);
+        }
+    }
+}
+
+/* ---------------------------------------
+ * polynomial_evaluate_interval tests
+ * --------------------------------------- */
+
+static Interval closed_interval(double lower, double upper)
+{
+    return create_interval(extended_value_finite(lower), extended_value_finite(upper), true, true);
+}
+
+static void test_interval_encloses_samples(void **state)
+{
+    (void)state;
+
+    double c[] = {0.5, -3.0, 2.25, 7.0, -1.0, 0.125, -4.0, 1.0};
+    Polynomial p = make_poly(7, c);
+
+    for (double lower = -2.0; lower < 2.0; lower += 0.375)
+    {
+        double upper = lower + 0.25;
+        Interval enclosure = polynomial_evaluate_interval(&p, closed_interval(lower, upper));
+
+        assert_int_equal(enclosure.lower_bound.type, VALUE_FINITE);
+        assert_int_equal(enclosure.upper_bound.type, VALUE_FINITE);
+
+        for (int i = 0; i <= 64; i++)
+        {
+            double y = polynomial_evaluate(&p, lower + (upper - lower) * i / 64.0);
+            assert_true(enclosure.lower_bound.value <= y && y <= enclosure.upper_bound.value);
+        }
+    }
+}
+
+static void test_interval_narrow_is_tight(void **state)
+{
+    (void)state;
+
+    double c[] = {-1.0, 0.0, 1.0}; // x^2 - 1, dependency makes the natural form loose
+    Polynomial p = make_poly(2, c);
+
+    Interval enclosure = polynomial_evaluate_interval(&p, closed_interval(1.999, 2.001));
+
+    // exact range [2.996001, 3.004001]
+    assert_true(enclosure.lower_bound.value <= 2.996001);
+    assert_true(enclosure.upper_bound.value >= 3.004001);
+    assert_true(enclosure.upper_bound.value - enclosure.lower_bound.value < 0.0081);
+}
+
+static void test_interval_excludes_zero(void **state)
+{
+    (void)state;
+
+    double c[] = {-2.0, 0.0, 1.0}; // roots at +-sqrt(2)
+    Polynomial p = make_poly(2, c);
+
+    assert_true(polynomial_interval_excludes_zero(&p, closed_interval(-1.0, 1.0)));
+    assert_true(polynomial_interval_excludes_zero(&p, closed_interval(1.5, 3.0)));
+    assert_false(polynomial_interval_excludes_zero(&p, closed_interval(1.0, 1.5)));
+}
+
+static void test_interval_unbounded_input(void **state)
+{
+    (void)state;
+
+    double c[] = {1.0, 1.0};
+    Polynomial p = make_poly(1, c);
+
+    Interval enclosure = polynomial_evaluate_interval(&p, interval_all_real());
+
+    assert_int_equal(enclosure.lower_bound.type, VALUE_NEG_INF);
+    assert_int_equal(enclosure.upper_bound.type, VALUE_POS_INF);
+    assert_false(polynomial_interval_excludes_zero(&p, interval_all_real()));
+}
+
 /* ---------------------------------------
  * polynomial_limit tests
  * --------------------------------------- */
@@ -175,6 +413,23 @@ int main(void)
         cmocka_unit_test(test_value_quadratic),
         cmocka_unit_test(test_value_negative_x),
         cmocka_unit_test(test_value_zero_polynomial),
+        cmocka_unit_test(test_value_high_degree),
+
+        cmocka_unit_test(test_estrin_matches_horner_high_degree),
+        cmocka_unit_test(test_estrin_partial_block),
+        cmocka_unit_test(test_auto_scheme_selection),
+        cmocka_unit_test(test_compensated_near_multiple_root),
+        cmocka_unit_test(test_sign_at_clustered_roots),
+
+        cmocka_unit_test(test_derivatives_cubic),
+        cmocka_unit_test(test_derivatives_value_only),
+        cmocka_unit_test(test_derivatives_constant),
+        cmocka_unit_test(test_unrolled_kernels_match_horner_loop),
+
+        cmocka_unit_test(test_interval_encloses_samples),
+        cmocka_unit_test(test_interval_narrow_is_tight),
+        cmocka_unit_test(test_interval_excludes_zero),
+        cmocka_unit_test(test_interval_unbounded_input),
 
         cmocka_unit_test(test_limit_finite),
         cmocka_unit_test(test_limit_positive_infinity_even_degree),
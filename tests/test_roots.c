@@ -121,6 +121,27 @@ static void test_irrational_roots(void **state)
     free_polynomial(&p);
 }
 
+/* (x^2 - 2)^2 (x - 1) → ±√2 double, 1 simple */
+static void test_irrational_double_roots(void **state)
+{
+    (void)state;
+
+    double c[] = {-4.0, 4.0, 4.0, -4.0, -1.0, 1.0};
+    Polynomial p = create_polynomial(c, 5);
+
+    polynomial_find_properties(&p);
+
+    assert_int_equal(p.roots.size, 3);
+
+    root_array_list_sort(&p.roots);
+
+    assert_root_in_list(&p.roots, 0, -sqrt(2.0), 2);
+    assert_root_in_list(&p.roots, 1, 1.0, 1);
+    assert_root_in_list(&p.roots, 2, sqrt(2.0), 2);
+
+    free_polynomial(&p);
+}
+
 /* x^2 + 1 → no real roots */
 static void test_no_real_roots(void **state)
 {
@@ -148,7 +169,8 @@ int main(void)
         cmocka_unit_test(test_double_root),
         cmocka_unit_test(test_mixed_multiplicity_roots),
         cmocka_unit_test(test_no_real_roots),
-        cmocka_unit_test(test_irrational_roots)};
+        cmocka_unit_test(test_irrational_roots),
+        cmocka_unit_test(test_irrational_double_roots)};
 
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
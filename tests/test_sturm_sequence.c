@@ -118,6 +118,115 @@ static void test_sturm_interval_subset(void **state)
     free_polynomial(&p);
 }
 
+/* ---------------------------------
+ * Test: (x - 1)(x - 2)...(x - 8) → packed
+ * evaluation over mixed bounds
+ * --------------------------------- */
+static void test_sturm_many_members(void **state)
+{
+    (void)state;
+
+    Polynomial p = create_polynomial_from_formula("1", NULL, 0);
+
+    for (int i = 1; i <= 8; i++)
+    {
+        Polynomial factor = create_binomial(1, -i);
+        Polynomial product = polynomial_multiply(&p, &factor);
+
+        free_polynomial(&p);
+        free_polynomial(&factor);
+        p = product;
+    }
+
+    SturmSequence seq = create_sturm_sequence(&p);
+
+    Interval interval = whole_real_line();
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 8);
+
+    interval.lower_bound = extended_value_finite(0.5);
+    interval.upper_bound = extended_value_finite(4.5);
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 4);
+
+    interval.lower_bound = extended_value_neg_infinity();
+    interval.upper_bound = extended_value_finite(2.5);
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 2);
+
+    interval.lower_bound = extended_value_finite(7.5);
+    interval.upper_bound = extended_value_pos_infinity();
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 1);
+
+    free_sturm_sequence(&seq);
+    free_polynomial(&p);
+}
+
+/* ---------------------------------
+ * Test: (x - 1)(x - 1.0001)(x + 2) → roots
+ * closer than float resolution
+ * --------------------------------- */
+static void test_sturm_roots_closer_than_float(void **state)
+{
+    (void)state;
+
+    // (x - 1)(x - 1.0001)(x + 2): the pair is below float resolution of the values
+    // near x = 1, so those signs must come from the double sweep
+    double c[] = {2.0002, -3.0001, -0.0001, 1.0};
+    Polynomial p = create_polynomial(c, 3);
+
+    SturmSequence seq = create_sturm_sequence(&p);
+
+    Interval interval = whole_real_line();
+    interval.lower_bound = extended_value_finite(0.99995);
+    interval.upper_bound = extended_value_finite(1.00005);
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 1);
+
+    interval.lower_bound = extended_value_finite(1.00005);
+    interval.upper_bound = extended_value_finite(1.5);
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 1);
+
+    interval.lower_bound = extended_value_finite(-3.0);
+    interval.upper_bound = extended_value_finite(0.0);
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 1);
+
+    free_sturm_sequence(&seq);
+    free_polynomial(&p);
+}
+
+/* ---------------------------------
+ * Test: (x - 1/16)(x - 2/16)...(x - 1) → exact chain
+ * past STURM_EXACT_DEGREE
+ * --------------------------------- */
+static void test_sturm_exact_chain(void **state)
+{
+    (void)state;
+
+    // the coefficients are dyadic with at most 45 significant bits, so the double
+    // polynomial is exactly this product; the floating point chain finds only 13
+    Polynomial p = create_polynomial_from_formula("1", NULL, 0);
+
+    for (int k = 1; k <= 16; k++)
+    {
+        Polynomial factor = create_binomial(1, -k / 16.0);
+        polynomial_multiply_into(&p, &p, &factor);
+        free_polynomial(&factor);
+    }
+
+    SturmSequence seq = create_sturm_sequence(&p);
+    assert_non_null(seq.exact_polynomials);
+
+    Interval interval = whole_real_line();
+    assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 16);
+
+    for (int k = 1; k <= 16; k++)
+    {
+        interval.lower_bound = extended_value_finite((k - 0.5) / 16.0);
+        interval.upper_bound = extended_value_finite((k + 0.5) / 16.0);
+        assert_int_equal(sturm_sequence_count_real_roots_in_interval(&seq, interval), 1);
+    }
+
+    free_sturm_sequence(&seq);
+    free_polynomial(&p);
+}
+
 /* ---------------------------------
  * Test runner
  * --------------------------------- */
@@ -129,6 +238,9 @@ int main(void)
         cmocka_unit_test(test_sturm_three_real_roots),
         cmocka_unit_test(test_sturm_linear_polynomial),
         cmocka_unit_test(test_sturm_interval_subset),
+        cmocka_unit_test(test_sturm_many_members),
+        cmocka_unit_test(test_sturm_roots_closer_than_float),
+        cmocka_unit_test(test_sturm_exact_chain),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);